@@ -72,6 +72,22 @@
 
 /*****************************************************************************/
 
+/* Data Types */
+
+/**
+ * @brief LovyanGFX pixel type of the LVGL render buffers. With
+ * LV_COLOR_16_SWAP, LVGL renders RGB565 in the byte order that the panel
+ * bus expects, so LovyanGFX sends the buffers as they are, without any
+ * per-pixel conversion.
+ */
+#if LV_COLOR_16_SWAP
+    typedef lgfx::swap565_t screen_pixel_t;
+#else
+    typedef lgfx::rgb565_t screen_pixel_t;
+#endif
+
+/*****************************************************************************/
+
 /* Screen Configuration Constants */
 
 namespace ns_const
@@ -87,10 +103,16 @@ namespace ns_const
     static constexpr uint16_t SCREEN_HEIGHT = 320U;
 
     /**
-     * @brief Screen Buffer Size.
+     * @brief Use two render buffers, so LVGL can draw into one of them while
+     * the other one is being transferred to the screen through DMA.
+     */
+    static constexpr bool SCREEN_DOUBLE_BUFFER = true;
+
+    /**
+     * @brief Screen Buffer Size (for each buffer).
      */
     static constexpr uint32_t SCREEN_BUFFER_SIZE
-        = (SCREEN_WIDTH * SCREEN_HEIGHT / 5U);
+        = (SCREEN_WIDTH * SCREEN_HEIGHT / (SCREEN_DOUBLE_BUFFER ? 10U : 5U));
 }
 
 /*****************************************************************************/
@@ -50,6 +50,7 @@
 #include "config/config.h"
 #include "config/config_screen.h"
 #include "buzzer/driver_passive_buzzer.h"
+#include "hal/i2c_arduino_wire.h"
 #include "touch_panel/driver_ft6236.h"
 
 /*****************************************************************************/
@@ -71,8 +72,12 @@ void manage_ui();
 // LVGL Callbacks
 void display_refresh(lv_disp_drv_t* disp_drv, const lv_area_t* area,
     lv_color_t* color_p);
+void display_flush_wait(lv_disp_drv_t* disp_drv);
 void display_manage_touch(lv_indev_drv_t* indev_driver, lv_indev_data_t* data);
 
+// Display Flush
+void display_flush_complete();
+
 // UI Draw
 void ui_draw_screen_1();
 
@@ -87,16 +92,22 @@ PassiveBuzzer Buzzer(IO_BUZZER, 0U, ns_const::BUZZER_MIN_FREQ_HZ,
 // Screen Device
 LGFX Screen;
 
-// Touch Panel
+// Touch Panel (I2C transport resolved at compile time)
+FT6236<ArduinoWireI2C> TouchPanel;
 uint16_t touch_x = 0U;
 uint16_t touch_y = 0U;
 
 // Buzzer Frequency
 uint16_t buzzer_freq = ns_const::BUZZER_MIN_FREQ_HZ;
 
-// UI Render Buffer
+// UI Render Buffers
 lv_disp_draw_buf_t draw_buf;
-lv_color_t buf[ns_const::SCREEN_BUFFER_SIZE];
+lv_color_t buf_1[ns_const::SCREEN_BUFFER_SIZE];
+lv_color_t buf_2[ns_const::SCREEN_DOUBLE_BUFFER ?
+    ns_const::SCREEN_BUFFER_SIZE : 1U];
+
+// Display Driver with a DMA flush transfer in progress
+lv_disp_drv_t* flush_pending_drv = nullptr;
 
 // UI Draw Texts buffer
 static const uint32_t MAX_TEXT_LENGTH = 1024U;
@@ -170,11 +181,14 @@ void buzzer_init()
 
 void touch_init()
 {
-    uint8_t error = touch_panel_init(SDA_FT6236, SCL_FT6236);
-    if (error == 0)
+    uint8_t id[TOUCH_PANEL_ID_LENGTH];
+
+    // Setup I2C bus and check that the Touch Panel answers
+    ArduinoWireI2C::begin(SDA_FT6236, SCL_FT6236);
+    if (TouchPanel.read_id(id))
     {   Serial.printf("[OK] Touch init\n");   }
     else
-    {   Serial.printf("[FAIL] Touch init (error code %d)\n", (int)(error));   }
+    {   Serial.printf("[FAIL] Touch init\n");   }
 }
 
 void screen_init()
@@ -190,7 +204,9 @@ void screen_init()
 void display_init()
 {
     lv_init();
-    lv_disp_draw_buf_init(&draw_buf, buf, NULL, ns_const::SCREEN_BUFFER_SIZE);
+    lv_color_t* buf_2_ptr = (ns_const::SCREEN_DOUBLE_BUFFER) ? buf_2 : NULL;
+    lv_disp_draw_buf_init(&draw_buf, buf_1, buf_2_ptr,
+        ns_const::SCREEN_BUFFER_SIZE);
 
     // Setup Display
     static lv_disp_drv_t disp_drv;
@@ -198,6 +214,7 @@ void display_init()
     disp_drv.hor_res = ns_const::SCREEN_WIDTH;
     disp_drv.ver_res = ns_const::SCREEN_HEIGHT;
     disp_drv.flush_cb = display_refresh;
+    disp_drv.wait_cb = display_flush_wait;
     disp_drv.draw_buf = &draw_buf;
     lv_disp_drv_register(&disp_drv);
 
@@ -248,6 +265,7 @@ void manage_buzzer()
 void manage_ui()
 {
     lv_timer_handler();
+    display_flush_complete();
 }
 
 /*****************************************************************************/
@@ -260,11 +278,30 @@ void display_refresh(lv_disp_drv_t* disp_drv, const lv_area_t* area,
     uint32_t w = (area->x2 - area->x1 + 1U);
     uint32_t h = (area->y2 - area->y1 + 1U);
 
+    // Single buffer, LVGL can't keep rendering until the buffer is sent
+    if (ns_const::SCREEN_DOUBLE_BUFFER == false)
+    {
+        Screen.startWrite();
+        Screen.setAddrWindow(area->x1, area->y1, w, h);
+        Screen.writePixels((screen_pixel_t*)&color_p->full, w * h);
+        Screen.endWrite();
+        lv_disp_flush_ready(disp_drv);
+        return;
+    }
+
+    // Double buffer, launch the DMA transfer and return, so LVGL renders
+    // the next area into the other buffer while this one is being sent
+    // (the flush is released by display_flush_complete())
     Screen.startWrite();
     Screen.setAddrWindow(area->x1, area->y1, w, h);
-    Screen.writePixels((lgfx::rgb565_t *)&color_p->full, w * h);
-    Screen.endWrite();
-    lv_disp_flush_ready(disp_drv);
+    Screen.writePixelsDMA((screen_pixel_t*)&color_p->full, w * h);
+    flush_pending_drv = disp_drv;
+}
+
+void display_flush_wait(lv_disp_drv_t* disp_drv)
+{
+    // LVGL calls this while waiting a buffer to be released
+    display_flush_complete();
 }
 
 void slider_event_cb(lv_event_t* event)
@@ -286,7 +323,7 @@ void display_manage_touch(lv_indev_drv_t* indev_driver, lv_indev_data_t* data)
 {
     int pos[2] = {0, 0};
 
-    touch_panel_get_position(pos);
+    TouchPanel.get_position(pos);
 
     if ( (pos[0] > 0) && (pos[1] > 0) )
     {
@@ -308,6 +345,25 @@ void display_manage_touch(lv_indev_drv_t* indev_driver, lv_indev_data_t* data)
 
 /*****************************************************************************/
 
+/* Display Flush Functions */
+
+void display_flush_complete()
+{
+    // Nothing to do if there is no transfer in progress or it is not done
+    if (flush_pending_drv == nullptr)
+    {   return;   }
+    if (Screen.dmaBusy())
+    {   return;   }
+
+    // Transfer completed, close it and release the buffer to LVGL
+    lv_disp_drv_t* disp_drv = flush_pending_drv;
+    flush_pending_drv = nullptr;
+    Screen.endWrite();
+    lv_disp_flush_ready(disp_drv);
+}
+
+/*****************************************************************************/
+
 /* LVGL UI Screen Draws */
 
 void ui_draw_screen_1()
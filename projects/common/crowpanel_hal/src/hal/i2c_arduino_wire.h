@@ -0,0 +1,102 @@
+/**
+ * @file    i2c_arduino_wire.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Arduino Wire I2C transport policy (shared drivers HAL).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef I2C_ARDUINO_WIRE_H
+#define I2C_ARDUINO_WIRE_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+// I2C Driver
+#include <Wire.h>
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief I2C transport through the Arduino Wire bus.
+ */
+struct ArduinoWireI2C
+{
+    static bool begin(const uint8_t pin_i2c_sda, const uint8_t pin_i2c_scl)
+    {
+        return Wire.begin(static_cast<int>(pin_i2c_sda),
+            static_cast<int>(pin_i2c_scl));
+    }
+
+    static bool read_registers(const uint16_t address, const uint8_t reg,
+        uint8_t* data, const size_t length)
+    {
+        // Write Request (first register address, keep the bus for the read)
+        Wire.beginTransmission(static_cast<uint8_t>(address));
+        Wire.write(reg);
+        if (Wire.endTransmission(false) != 0)
+        {   return false;   }
+
+        // Read Response (slave auto-increments the register address)
+        Wire.requestFrom(static_cast<int>(address), static_cast<int>(length));
+        if (static_cast<size_t>(Wire.available()) < length)
+        {   return false;   }
+        for (size_t i = 0U; i < length; i++)
+        {   data[i] = static_cast<uint8_t>(Wire.read());   }
+
+        return true;
+    }
+
+    static bool write_register(const uint16_t address, const uint8_t reg,
+        const uint8_t value)
+    {
+        Wire.beginTransmission(static_cast<uint8_t>(address));
+        Wire.write(reg);
+        Wire.write(value);
+        return (Wire.endTransmission() == 0);
+    }
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* I2C_ARDUINO_WIRE_H */
@@ -0,0 +1,92 @@
+/**
+ * @file    i2c_espidf.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * ESP-IDF I2C driver transport policy (shared drivers HAL).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef I2C_ESPIDF_H
+#define I2C_ESPIDF_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+// FreeRTOS Libraries
+#include "freertos/FreeRTOS.h"
+
+// ESP-IDF Framework
+#include "driver/i2c.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief I2C transport through the ESP-IDF I2C master driver (installed by
+ * the application on the PORT bus), with blocking transactions.
+ */
+template <i2c_port_t PORT, uint32_t TIMEOUT_MS = 10U>
+struct EspIdfI2C
+{
+    static bool read_registers(const uint16_t address, const uint8_t reg,
+        uint8_t* data, const size_t length)
+    {
+        esp_err_t rc = i2c_master_write_read_device(PORT,
+            static_cast<uint8_t>(address), &reg, 1U, data, length,
+            pdMS_TO_TICKS(TIMEOUT_MS));
+        return (rc == ESP_OK);
+    }
+
+    static bool write_register(const uint16_t address, const uint8_t reg,
+        const uint8_t value)
+    {
+        const uint8_t data[2] = { reg, value };
+        esp_err_t rc = i2c_master_write_to_device(PORT,
+            static_cast<uint8_t>(address), data, sizeof(data),
+            pdMS_TO_TICKS(TIMEOUT_MS));
+        return (rc == ESP_OK);
+    }
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* I2C_ESPIDF_H */
@@ -0,0 +1,110 @@
+/**
+ * @file    i2c_mock.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Host mock I2C transport policy (shared drivers HAL), a registers map
+ * of a single I2C device to test and benchmark the drivers on the host.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef I2C_MOCK_H
+#define I2C_MOCK_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief I2C transport to a mocked device: reads and writes access its
+ * registers (with register address auto-increment), any other address is
+ * not acknowledged.
+ */
+struct MockI2C
+{
+    /**
+     * @brief Number of registers of the mocked device.
+     */
+    static constexpr size_t NUM_REGS = 256U;
+
+    static inline uint16_t device_address = 0U;
+    static inline uint8_t regs[NUM_REGS] = {0};
+    static inline bool fail = false;
+    static inline uint32_t reads = 0U;
+    static inline uint32_t writes = 0U;
+
+    static void reset(const uint16_t address)
+    {
+        device_address = address;
+        memset(regs, 0, sizeof(regs));
+        fail = false;
+        reads = 0U;
+        writes = 0U;
+    }
+
+    static bool read_registers(const uint16_t address, const uint8_t reg,
+        uint8_t* data, const size_t length)
+    {
+        reads = reads + 1U;
+        if ( fail || (address != device_address) )
+        {   return false;   }
+        for (size_t i = 0U; i < length; i++)
+        {   data[i] = regs[(reg + i) % NUM_REGS];   }
+        return true;
+    }
+
+    static bool write_register(const uint16_t address, const uint8_t reg,
+        const uint8_t value)
+    {
+        writes = writes + 1U;
+        if ( fail || (address != device_address) )
+        {   return false;   }
+        regs[reg] = value;
+        return true;
+    }
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* I2C_MOCK_H */
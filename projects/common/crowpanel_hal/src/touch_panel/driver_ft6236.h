@@ -0,0 +1,168 @@
+/**
+ * @file    driver_ft6236.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * FT6236 Touch Panel driver (shared by the Arduino and ESP-IDF projects).
+ * The I2C transport is a template policy, resolved at compile time, so the
+ * sample read and decode of the hot path is inlined in the caller.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef DRIVER_FT6236_H
+#define DRIVER_FT6236_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Constants */
+
+// Number of Identification Registers (library version to vendor ID)
+static constexpr size_t TOUCH_PANEL_ID_LENGTH = 8U;
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @brief FT6236 Touch Panel.
+ * @details The I2C policy must provide the static functions:
+ *   bool read_registers(const uint16_t address, const uint8_t reg,
+ *       uint8_t* data, const size_t length);
+ *   bool write_register(const uint16_t address, const uint8_t reg,
+ *       const uint8_t value);
+ * See hal/ for the Arduino Wire, ESP-IDF I2C driver and host mock ones.
+ */
+template <class I2C>
+class FT6236
+{
+    public:
+
+        /**
+         * @brief I2C Address.
+         */
+        static constexpr uint8_t I2C_ADDRESS = 0x38U;
+
+        /**
+         * @brief Identification Registers (G_LIB_VERSION_H to G_FT5201ID),
+         * read by read_id().
+         */
+        static constexpr uint8_t REG_LIB_VERSION_H = 0xA1U;
+
+        bool set_int_trigger_mode();
+
+        bool read_id(uint8_t id[TOUCH_PANEL_ID_LENGTH]);
+
+        void get_position(int pos[2]);
+
+    /******************************************************************/
+
+    private:
+
+        // Touch Status & First Touch Point X & Y Position Registers
+        static constexpr uint8_t REG_TD_STATUS = 0x02U;
+        static constexpr uint8_t REG_XH = 0x03U;
+        static constexpr uint8_t REG_XL = 0x04U;
+        static constexpr uint8_t REG_YH = 0x05U;
+        static constexpr uint8_t REG_YL = 0x06U;
+
+        // Interrupt Mode Register (0: INT low while touching; 1: INT pulse
+        // on each new touch report)
+        static constexpr uint8_t REG_G_MODE = 0xA4U;
+        static constexpr uint8_t G_MODE_TRIGGER = 0x01U;
+
+        // Number of Registers read on each sample (from TD_STATUS to YL)
+        static constexpr uint8_t SAMPLE_NUM_REGS =
+            (REG_YL - REG_TD_STATUS + 1U);
+};
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+template <class I2C>
+bool FT6236<I2C>::set_int_trigger_mode()
+{
+    return I2C::write_register(I2C_ADDRESS, REG_G_MODE, G_MODE_TRIGGER);
+}
+
+template <class I2C>
+bool FT6236<I2C>::read_id(uint8_t id[TOUCH_PANEL_ID_LENGTH])
+{
+    return I2C::read_registers(I2C_ADDRESS, REG_LIB_VERSION_H, id,
+        TOUCH_PANEL_ID_LENGTH);
+}
+
+template <class I2C>
+inline void FT6236<I2C>::get_position(int pos[2])
+{
+    uint8_t regs[SAMPLE_NUM_REGS] = {0};
+    int touches = 0;
+    int xl = 0;
+    int xh = 0;
+    int yl = 0;
+    int yh = 0;
+
+    pos[0] = -1;
+    pos[1] = -1;
+
+    // Read Touch Status and first Touch Point in a single transaction
+    if (I2C::read_registers(I2C_ADDRESS, REG_TD_STATUS, regs,
+        SAMPLE_NUM_REGS) == false)
+    {   return;   }
+    touches = regs[REG_TD_STATUS - REG_TD_STATUS] & 0x0F;
+    xh = regs[REG_XH - REG_TD_STATUS];
+    xl = regs[REG_XL - REG_TD_STATUS];
+    yh = regs[REG_YH - REG_TD_STATUS];
+    yl = regs[REG_YL - REG_TD_STATUS];
+
+    // No Touch or Lift Up event
+    if ( (touches == 0) || (xh >> 6 == 1) )
+    {   return;   }
+
+    pos[0] = ( ( (xh & 0x0F) << 8 ) | xl );
+    pos[1] = ( ( (yh & 0x0F) << 8 ) | yl );
+}
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* DRIVER_FT6236_H */
@@ -26,8 +26,11 @@
 /*Color depth: 1 (1 byte per pixel), 8 (RGB332), 16 (RGB565), 32 (ARGB8888)*/
 #define LV_COLOR_DEPTH 16
 
-/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)*/
-#define LV_COLOR_16_SWAP 0
+/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)
+ *Enabled to render in the LovyanGFX panel bus byte order (swap565), so flush sends the buffers without conversion*/
+#ifndef LV_COLOR_16_SWAP
+#define LV_COLOR_16_SWAP 1
+#endif
 
 /*Enable features to draw on transparent background.
  *It's required if opa, and transform_* style properties are used.
@@ -64,10 +67,11 @@
     //#define LV_MEM_CUSTOM_ALLOC   malloc
     //#define LV_MEM_CUSTOM_FREE    free
     //#define LV_MEM_CUSTOM_REALLOC realloc
-	#define LV_MEM_CUSTOM_INCLUDE <esp_heap_caps.h>   /*Header for the dynamic memory function*/
-	#define LV_MEM_CUSTOM_ALLOC(size) heap_caps_malloc(size, MALLOC_CAP_8BIT)
-	#define LV_MEM_CUSTOM_FREE(ptr) heap_caps_free(ptr)
-	#define LV_MEM_CUSTOM_REALLOC(ptr, size) heap_caps_realloc(ptr, size, MALLOC_CAP_8BIT)
+	/*Tiered allocator: small blocks in internal SRAM slab pools, large ones in PSRAM*/
+	#define LV_MEM_CUSTOM_INCLUDE "lv_allocator.h"   /*Header for the dynamic memory function*/
+	#define LV_MEM_CUSTOM_ALLOC(size) lv_allocator_malloc(size)
+	#define LV_MEM_CUSTOM_FREE(ptr) lv_allocator_free(ptr)
+	#define LV_MEM_CUSTOM_REALLOC(ptr, size) lv_allocator_realloc(ptr, size)
 #endif     /*LV_MEM_CUSTOM*/
 
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
@@ -0,0 +1,243 @@
+"""
+PlatformIO extra script: firmware build report.
+
+After each build, reports the firmware size by memory (flash code and data,
+IRAM and DRAM) and where the render and touch hot paths were placed (IRAM
+or flash). The "fps" target runs the screen buffers benchmark of the Serial
+console ('b' command) on the connected device and adds its FPS to the
+report. Reports are saved in the build directory and compared against the
+report of the baseline environment (custom_report_baseline option).
+
+Usage:
+    pio run -e esp32-s3-n16-r8 -t upload -t fps
+    pio run -e esp32-s3-n16-r8-release -t upload -t fps
+"""
+
+###############################################################################
+
+# Libraries
+
+import json
+import os
+import re
+import subprocess
+import time
+
+Import("env")
+
+###############################################################################
+
+# Constants
+
+# Report file (in the build directory of each environment)
+REPORT_FILE = "build_report.json"
+
+# ELF sections prefixes of each memory
+MEMORIES = (
+    ("flash_code", (".flash.text",)),
+    ("flash_data", (".flash.rodata", ".flash.appdesc")),
+    ("iram", (".iram0.",)),
+    ("dram", (".dram0.",)),
+)
+
+# Toolchain binutils arguments (sections sizes, demangled symbols)
+TOOLS_ARGS = {
+    "size": ["-A"],
+    "nm": ["-C", "--defined-only"],
+}
+
+# ESP32-S3 IRAM address range
+IRAM_START = 0x40370000
+IRAM_END = 0x403E0000
+
+# Render and touch hot paths functions (src/linker.lf)
+HOT_PATH_FUNCTIONS = (
+    "display_refresh",
+    "display_flush_wait",
+    "display_flush_complete",
+    "display_render_start",
+    "AreaCoalescer::coalesce",
+    "display_manage_touch",
+    "touch_read_sample",
+    "TouchI2C::read_registers",
+    "lv_draw_sw_blend_basic",
+    "lv_color_fill",
+    "lgfx::v1::Bus_Parallel16::writeBytes",
+)
+
+# Screen buffers benchmark output (see display_benchmark() in main.cpp)
+FPS_HEADER = "[Screen Buffers Benchmark]"
+FPS_ROW = re.compile(r"^\s+(\S+)\s+(\d+\.\d)\s+\d+ Bytes")
+
+# Device boot time after opening the Serial port, and max time without
+# benchmark output once started
+FPS_BOOT_WAIT_S = 5.0
+FPS_IDLE_TIMEOUT_S = 10.0
+
+###############################################################################
+
+# Functions
+
+
+def report_path(env_name):
+    return os.path.join(env.subst("$PROJECT_BUILD_DIR"), env_name,
+        REPORT_FILE)
+
+
+def report_load(env_name):
+    try:
+        with open(report_path(env_name)) as file:
+            return json.load(file)
+    except (OSError, ValueError):
+        return {}
+
+
+def report_save(report):
+    with open(report_path(env.subst("$PIOENV")), "w") as file:
+        json.dump(report, file, indent=4)
+
+
+def toolchain_run(tool, elf_path):
+    """Runs a toolchain binutils tool (size, nm) on the ELF."""
+    command = env.subst("$SIZETOOL").replace("-size", "-" + tool)
+    result = subprocess.run([command] + TOOLS_ARGS[tool] + [elf_path],
+        env=env["ENV"], capture_output=True, text=True)
+    return result.stdout.splitlines()
+
+
+def memory_sizes(elf_path):
+    sizes = {name: 0 for name, _ in MEMORIES}
+    for line in toolchain_run("size", elf_path):
+        fields = line.split()
+        if (len(fields) < 2) or (not fields[1].isdigit()):
+            continue
+        for name, prefixes in MEMORIES:
+            if fields[0].startswith(prefixes):
+                sizes[name] += int(fields[1])
+    return sizes
+
+
+def hot_paths_placement(elf_path):
+    """IRAM or flash placement of each hot path function (inlined ones are
+    not in the symbols table)."""
+    placement = {name: "not found" for name in HOT_PATH_FUNCTIONS}
+    for line in toolchain_run("nm", elf_path):
+        fields = line.split(maxsplit=2)
+        if (len(fields) < 3) or (fields[1].lower() != "t"):
+            continue
+        symbol = fields[2].split("(")[0]
+        if symbol not in placement:
+            continue
+        address = int(fields[0], 16)
+        in_iram = (IRAM_START <= address < IRAM_END)
+        placement[symbol] = "IRAM" if in_iram else "flash"
+    return placement
+
+
+def report_print(report):
+    env_name = env.subst("$PIOENV")
+    baseline_name = env.GetProjectOption("custom_report_baseline", "")
+    baseline = report_load(baseline_name) if baseline_name else {}
+
+    print("\n[Build Report] %s%s" % (env_name,
+        (" vs " + baseline_name) if baseline else ""))
+    print("  %-16s %12s %12s %10s" % ("", "Build", "Baseline", "Change"))
+    for name, size in report.get("memory", {}).items():
+        base_size = baseline.get("memory", {}).get(name)
+        print_row(name + " (B)", size, base_size, "%12d")
+    for name, fps in report.get("fps", {}).items():
+        base_fps = baseline.get("fps", {}).get(name)
+        print_row("FPS " + name, fps, base_fps, "%12.1f")
+
+    placement = report.get("hot_paths", {})
+    in_iram = [name for name, where in placement.items() if where == "IRAM"]
+    print("  Hot paths in IRAM: %d/%d" % (len(in_iram), len(placement)))
+    for name, where in placement.items():
+        if where != "IRAM":
+            print("    %s: %s" % (name, where))
+
+
+def print_row(name, value, base_value, value_format):
+    if base_value is None:
+        print(("  %-16s " + value_format) % (name, value))
+        return
+    change = ""
+    if base_value != 0:
+        change = "%+.1f%%" % (((value - base_value) * 100.0) / base_value)
+    print(("  %-16s " + value_format + " " + value_format + " %10s") %
+        (name, value, base_value, change))
+
+
+def build_report(source, target, env):
+    elf_path = str(target[0])
+    report = report_load(env.subst("$PIOENV"))
+    report["memory"] = memory_sizes(elf_path)
+    report["hot_paths"] = hot_paths_placement(elf_path)
+    report_save(report)
+    report_print(report)
+
+
+def fps_report(source, target, env):
+    """Runs the screen buffers benchmark on the device and parses the FPS
+    of each strategy."""
+    import serial
+
+    port = env.subst("$MONITOR_PORT") or env.subst("$UPLOAD_PORT")
+    if not port:
+        env.AutodetectUploadPort()
+        port = env.subst("$UPLOAD_PORT")
+    speed = int(env.GetProjectOption("monitor_speed", 115200))
+
+    # Don't reset the device on open (DTR/RTS), it may be just uploaded
+    device = serial.Serial()
+    device.port = port
+    device.baudrate = speed
+    device.timeout = 0.5
+    device.dtr = False
+    device.rts = False
+    device.open()
+    time.sleep(FPS_BOOT_WAIT_S)
+    device.reset_input_buffer()
+    device.write(b"b")
+
+    fps = {}
+    started = False
+    t_last_output = time.time()
+    while (time.time() - t_last_output) < FPS_IDLE_TIMEOUT_S:
+        line = device.readline().decode(errors="ignore").rstrip()
+        if not line:
+            continue
+        t_last_output = time.time()
+        if FPS_HEADER in line:
+            started = True
+            continue
+        row = FPS_ROW.match(line)
+        if started and row:
+            fps[row.group(1)] = float(row.group(2))
+        elif started and fps and (not line.startswith("  ")):
+            break
+    device.close()
+
+    if not fps:
+        print("[Build Report] No screen buffers benchmark output on %s" %
+            port)
+        return 1
+    report = report_load(env.subst("$PIOENV"))
+    report["fps"] = fps
+    report_save(report)
+    report_print(report)
+    return 0
+
+###############################################################################
+
+# Setup
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", build_report)
+
+env.AddCustomTarget(
+    name="fps",
+    dependencies=None,
+    actions=[fps_report],
+    title="FPS Report",
+    description="Measure FPS on the device and add it to the build report",
+)
@@ -40,15 +40,11 @@
 // Library Header
 #include "driver_passive_buzzer.h"
 
+// Standard C++ Libraries
+#include <cstdio>
+
 // ESP-IDF Framework
 #include "controller/pwm/pwm.h"
-#include "esp_timer.h"
-
-/*****************************************************************************/
-
-/* In-Scope Functions */
-
-static inline uint32_t millis();
 
 /*****************************************************************************/
 
@@ -63,96 +59,212 @@ PassiveBuzzer::PassiveBuzzer(const int8_t pin, const uint8_t pwm_channel,
 
 void PassiveBuzzer::init()
 {
-    const int pwm_channel = 0;
-    printf("LEDC setup\n");
-    ledc_setup(pwm_channel, MIN_FREQ_HZ, 10U);
-    printf("Attach Pin\n");
-    ledc_attach_pin(_pin, pwm_channel);
+    esp_timer_create_args_t timer_args = {};
+    timer_args.callback = beep_timer_callback;
+    timer_args.arg = this;
+    timer_args.dispatch_method = ESP_TIMER_TASK;
+    timer_args.name = "buzzer";
+    printf("Beep Timer create\n");
+    if (esp_timer_create(&timer_args, &beep_timer) != ESP_OK)
+    {   return;   }
+    // PWM channel with its own timer (tones change its frequency)
+    printf("PWM channel alloc\n");
+    pwm_channel = ledc_alloc(_pwm_channel, _pin, _max_freq,
+        PWM_RESOLUTION_BITS, true);
+    if (pwm_channel < 0)
+    {
+        printf("[FAIL] Buzzer PWM channel %u not available\n", _pwm_channel);
+        return;
+    }
     printf("Beep OFF\n");
     beep_off();
     is_initialized = true;
 }
 
+/**
+ * @details Stops the sequencer and drops the queued tones. It must not be
+ * called while other task or ISR is enqueuing tones.
+ */
 void PassiveBuzzer::beep_off()
 {
-    beeping = false;
-    beep_request = false;
-    beep_request_time = 0U;
-    t0 = 0U;
+    if (beep_timer != nullptr)
+    {   esp_timer_stop(beep_timer);   }
     set_pwm(0U);
+    tones.clear();
+    tone_on = false;
+    melody = nullptr;
+    playing.store(false);
 }
 
-void PassiveBuzzer::beep(uint16_t frequency, const uint16_t beep_time_ms)
+bool PassiveBuzzer::is_beeping()
 {
-    // Do nothing if component is not initialized
-    if (is_initialized == false)
-    {   return;   }
-    if (beeping)
-    {   return;   }
+    return playing.load();
+}
 
-    // Stop any beep
-    beep_off();
-    beeping = false;
-    beep_request = true;
-    beep_request_time = (unsigned long)(beep_time_ms);
-
-    // Setup new frequency
-    if (frequency < _min_freq)
-    {   frequency = _min_freq;   }
-    if (frequency > _max_freq)
-    {   frequency = _max_freq;   }
-    ledc_setup(_pwm_channel, frequency, 10U);
+/**
+ * @details The beep is queued after any pending tones (false if the queue
+ * is full).
+ */
+bool PassiveBuzzer::beep(const uint16_t frequency,
+    const uint16_t beep_time_ms, const uint16_t gap_ms)
+{
+    buzzer_tone_t tone = { frequency, beep_time_ms, gap_ms, nullptr };
+    return enqueue(tone);
 }
 
-void PassiveBuzzer::process()
+/**
+ * @details The melody is queued after any pending tones, its notes are
+ * read from flash by the sequencer while it plays.
+ */
+bool PassiveBuzzer::play(const melody_t* melody)
 {
+    if (melody == nullptr)
+    {   return false;   }
+
+    buzzer_tone_t tone = { 0U, 0U, 0U, melody };
+    return enqueue(tone);
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details Lock-free, from the single producer task or ISR. If the
+ * sequencer is idle, the producer that wakes it up (playing flag from
+ * false to true) starts the beep timer to run the sequencer right away.
+ */
+bool PassiveBuzzer::enqueue(const buzzer_tone_t& tone)
+{
+    bool idle = false;
+
     // Do nothing if component is not initialized
     if (is_initialized == false)
-    {   return;   }
+    {   return false;   }
 
-    // Do nothing if there is no Beep request
-    if (beep_request == false)
-    {   return;   }
+    if (tones.push(tone) == false)
+    {   return false;   }
+
+    // Tone published before checking the sequencer state (see the sequencer
+    // stop, so a queued tone is never left without a sequencer to play it)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (playing.compare_exchange_strong(idle, true))
+    {   esp_timer_start_once(beep_timer, 0U);   }
+    return true;
+}
 
-    // Handle beep start
-    if (beeping == false)
+/**
+ * @details Runs from the beep timer: ends the current tone (waiting its
+ * gap if any), then starts the next one or stops the sequencer if there
+ * are no more tones.
+ */
+void PassiveBuzzer::sequencer_step()
+{
+    buzzer_tone_t tone;
+
+    // Tone time elapsed, stop it and wait its gap
+    if (tone_on)
     {
-        set_pwm(_duty_cycle);
-        t0 = millis();
-        beeping = true;
-        return;
+        set_pwm(0U);
+        tone_on = false;
+        if (tone_gap_ms > 0U)
+        {
+            esp_timer_start_once(beep_timer,
+                static_cast<uint64_t>(tone_gap_ms) * 1000ULL);
+            return;
+        }
     }
 
-    // Do nothing if time to stop beeping has not come
-    if (millis() - t0 < beep_request_time)
-    {   return;   }
+    // No more tones, stop the sequencer unless a tone was just queued and
+    // this is the one that wakes it up again
+    while (sequencer_next_tone(tone) == false)
+    {
+        bool idle = false;
+        playing.store(false);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if ( tones.is_empty() ||
+             (playing.compare_exchange_strong(idle, true) == false) )
+        {   return;   }
+    }
 
-    // Handle beep stop
-    beep_off();
-    beeping = false;
-    beep_request = false;
+    tone_start(tone);
 }
 
-/*****************************************************************************/
+/**
+ * @details Next note of the playing melody, or next queued tone (a queued
+ * melody starts playing from its first note).
+ */
+bool PassiveBuzzer::sequencer_next_tone(buzzer_tone_t& tone)
+{
+    while (true)
+    {
+        if (melody != nullptr)
+        {
+            if (melody_note < melody->num_notes)
+            {
+                tone = melody_get_tone(*melody, melody_note);
+                melody_note = melody_note + 1U;
+                return true;
+            }
+            melody = nullptr;
+        }
 
-/* Private Methods */
+        if (tones.pop(tone) == false)
+        {   return false;   }
+        if (tone.melody == nullptr)
+        {   return true;   }
+
+        melody = tone.melody;
+        melody_note = 0U;
+    }
+}
+
+void PassiveBuzzer::tone_start(const buzzer_tone_t& tone)
+{
+    uint16_t frequency = tone.frequency;
+
+    // Setup new frequency and start the tone (silence if no frequency)
+    if (frequency != 0U)
+    {
+        if (frequency < _min_freq)
+        {   frequency = _min_freq;   }
+        if (frequency > _max_freq)
+        {   frequency = _max_freq;   }
+        ledc_change_frequency(pwm_channel, frequency);
+        set_pwm(_duty_cycle);
+    }
+    tone_on = true;
+    tone_gap_ms = tone.gap_ms;
+
+    // The beep timer ends the tone when its time elapses
+    esp_timer_start_once(beep_timer,
+        static_cast<uint64_t>(tone.duration_ms) * 1000ULL);
+}
 
 void PassiveBuzzer::set_pwm(uint8_t percentage)
 {
+    if (pwm_channel < 0)
+    {   return;   }
     if(percentage > 100)
     {   percentage = 100U;   }
 
-    uint8_t duty_cycle_value = (percentage * 255U) / 100U;
-    ledc_write(_pwm_channel, duty_cycle_value);
+    uint32_t max_duty = (1U << PWM_RESOLUTION_BITS) - 1U;
+    uint32_t duty_cycle_value = (percentage * max_duty) / 100U;
+    ledc_write(pwm_channel, duty_cycle_value);
 }
 
 /*****************************************************************************/
 
-/* Private Methods - Millis */
+/* Private Methods - Beep Timer */
 
-static inline uint32_t millis()
+/**
+ * @details Runs from the esp_timer task at the exact tone edges times (no
+ * need to poll the buzzer from the main loop).
+ */
+void PassiveBuzzer::beep_timer_callback(void* arg)
 {
-    return static_cast<uint32_t>(esp_timer_get_time() / 1000LL);
+    PassiveBuzzer* buzzer = static_cast<PassiveBuzzer*>(arg);
+    buzzer->sequencer_step();
 }
 
 /*****************************************************************************/
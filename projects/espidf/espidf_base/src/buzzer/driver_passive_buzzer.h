@@ -45,8 +45,16 @@
 /* Libraries */
 
 // Standard C++ Libraries
+#include <atomic>
 #include <cstdint>
 
+// ESP-IDF Framework
+#include "esp_timer.h"
+
+// Buzzer Tones and Melodies
+#include "buzzer/melody.h"
+#include "buzzer/tone_queue.h"
+
 /*****************************************************************************/
 
 /* Class Interface */
@@ -62,11 +70,14 @@ class PassiveBuzzer
 
         void init();
 
-        void beep(uint16_t frequency, const uint16_t beep_time_ms);
+        bool beep(const uint16_t frequency, const uint16_t beep_time_ms,
+            const uint16_t gap_ms=0U);
+
+        bool play(const melody_t* melody);
 
         void beep_off();
 
-        void process();
+        bool is_beeping();
 
     /******************************************************************/
 
@@ -75,6 +86,7 @@ class PassiveBuzzer
         static constexpr const uint16_t MIN_FREQ_HZ = 0U;
         static constexpr const uint16_t MAX_FREQ_HZ = 2700U;
         static constexpr const uint8_t DUTY_CYCLE = 50U;
+        static constexpr const uint8_t PWM_RESOLUTION_BITS = 10U;
 
         const int8_t _pin;
         const uint8_t _pwm_channel;
@@ -83,12 +95,30 @@ class PassiveBuzzer
         const uint8_t _duty_cycle;
 
         bool is_initialized = false;
-        bool beep_request = false;
-        bool beeping = false;
-        unsigned long beep_request_time = 0U;
-        unsigned long t0 = 0U;
+        int8_t pwm_channel = -1;
+        esp_timer_handle_t beep_timer = nullptr;
+
+        // Tones Queue (producer: enqueue(), consumer: the sequencer)
+        ToneQueue tones;
+        std::atomic<bool> playing{false};
+
+        // Sequencer State (only used from the beep timer)
+        bool tone_on = false;
+        uint16_t tone_gap_ms = 0U;
+        const melody_t* melody = nullptr;
+        uint8_t melody_note = 0U;
+
+        bool enqueue(const buzzer_tone_t& tone);
+
+        void sequencer_step();
+
+        bool sequencer_next_tone(buzzer_tone_t& tone);
+
+        void tone_start(const buzzer_tone_t& tone);
 
         void set_pwm(uint8_t percentage);
+
+        static void beep_timer_callback(void* arg);
 };
 
 /*****************************************************************************/
@@ -0,0 +1,154 @@
+/**
+ * @file    melody.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Buzzer melodies compact format (RTTTL like notes stored in flash).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "melody.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Frequencies of the highest supported octave (MIDI octave 9: C8 to B8),
+// lower octaves frequencies are halved from them
+static constexpr uint16_t TOP_OCTAVE_FREQUENCIES_HZ[12] =
+{
+    4186U, 4435U, 4699U, 4978U, 5274U, 5588U,
+    5920U, 6272U, 6645U, 7040U, 7459U, 7902U
+};
+static constexpr uint8_t TOP_OCTAVE = 9U;
+
+// Whole note time at 1 bpm (4 quarter notes of 1 minute)
+static constexpr uint32_t WHOLE_NOTE_MS_BPM = 4U * 60000U;
+
+/*****************************************************************************/
+
+/* Melodies Notes */
+
+static constexpr melody_note_t MELODY_STARTUP_NOTES[] =
+{
+    { melody_pitch(NOTE_C, 6), 16U },
+    { melody_pitch(NOTE_E, 6), 16U },
+    { melody_pitch(NOTE_G, 6), 16U },
+    { melody_pitch(NOTE_C, 7), 8U | MELODY_DOTTED },
+};
+
+static constexpr melody_note_t MELODY_ALARM_NOTES[] =
+{
+    { melody_pitch(NOTE_A, 6), 8U }, { melody_pitch(NOTE_E, 6), 8U },
+    { melody_pitch(NOTE_A, 6), 8U }, { melody_pitch(NOTE_E, 6), 8U },
+    { MELODY_REST, 4U },
+    { melody_pitch(NOTE_A, 6), 8U }, { melody_pitch(NOTE_E, 6), 8U },
+    { melody_pitch(NOTE_A, 6), 8U }, { melody_pitch(NOTE_E, 6), 8U },
+};
+
+/*****************************************************************************/
+
+/* Melodies */
+
+const melody_t MELODY_STARTUP =
+{
+    180U, 10U,
+    sizeof(MELODY_STARTUP_NOTES) / sizeof(MELODY_STARTUP_NOTES[0]),
+    MELODY_STARTUP_NOTES
+};
+
+const melody_t MELODY_ALARM =
+{
+    140U, 20U,
+    sizeof(MELODY_ALARM_NOTES) / sizeof(MELODY_ALARM_NOTES[0]),
+    MELODY_ALARM_NOTES
+};
+
+/*****************************************************************************/
+
+/* Public Functions */
+
+/**
+ * @details Integer only (it runs from the buzzer timer): the note
+ * frequency of the top octave halved for each octave below.
+ */
+uint16_t melody_pitch_frequency(const uint8_t pitch)
+{
+    uint8_t octave = pitch / 12U;
+
+    if ( (pitch == MELODY_REST) || (octave > TOP_OCTAVE) )
+    {   return 0U;   }
+    return (TOP_OCTAVE_FREQUENCIES_HZ[pitch % 12U] >> (TOP_OCTAVE - octave));
+}
+
+/**
+ * @details The gap is taken from the end of the note time, so the melody
+ * tempo does not depend on it.
+ */
+buzzer_tone_t melody_get_tone(const melody_t& melody, const uint8_t index)
+{
+    buzzer_tone_t tone = { 0U, 0U, 0U, nullptr };
+
+    if ( (index >= melody.num_notes) || (melody.bpm == 0U) )
+    {   return tone;   }
+
+    const melody_note_t& note = melody.notes[index];
+    uint8_t fraction = note.duration & static_cast<uint8_t>(~MELODY_DOTTED);
+    if (fraction == 0U)
+    {   return tone;   }
+
+    uint32_t note_ms = WHOLE_NOTE_MS_BPM / (melody.bpm * fraction);
+    if (note.duration & MELODY_DOTTED)
+    {   note_ms = (note_ms * 3U) / 2U;   }
+
+    tone.frequency = melody_pitch_frequency(note.pitch);
+    tone.gap_ms = (note_ms > melody.gap_ms) ? melody.gap_ms : 0U;
+    tone.duration_ms = static_cast<uint16_t>(note_ms - tone.gap_ms);
+    return tone;
+}
+
+uint32_t melody_get_duration_ms(const melody_t& melody)
+{
+    uint32_t duration_ms = 0U;
+
+    for (uint8_t i = 0U; i < melody.num_notes; i++)
+    {
+        buzzer_tone_t tone = melody_get_tone(melody, i);
+        duration_ms = duration_ms + tone.duration_ms + tone.gap_ms;
+    }
+    return duration_ms;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,137 @@
+/**
+ * @file    melody.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Buzzer melodies compact format (RTTTL like notes stored in flash).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef MELODY_H
+#define MELODY_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Buzzer Tones
+#include "buzzer/tone_queue.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Note names (semitones from C).
+ */
+enum melody_note_name_t
+{
+    NOTE_C = 0,
+    NOTE_CS,
+    NOTE_D,
+    NOTE_DS,
+    NOTE_E,
+    NOTE_F,
+    NOTE_FS,
+    NOTE_G,
+    NOTE_GS,
+    NOTE_A,
+    NOTE_AS,
+    NOTE_B
+};
+
+/**
+ * @brief Melody note (2 Bytes): pitch as MIDI note number (MELODY_REST for
+ * silence) and RTTTL like duration as note fraction (1 whole, 2 half, 4
+ * quarter, 8 eighth, 16, 32), plus MELODY_DOTTED for dotted notes.
+ */
+struct melody_note_t
+{
+    uint8_t pitch;
+    uint8_t duration;
+};
+
+/**
+ * @brief Melody: tempo (quarter notes per minute), silence gap at the end
+ * of each note (taken from the note time) and the notes.
+ */
+struct melody_t
+{
+    uint16_t bpm;
+    uint16_t gap_ms;
+    uint8_t num_notes;
+    const melody_note_t* notes;
+};
+
+/*****************************************************************************/
+
+/* Constants */
+
+static constexpr uint8_t MELODY_REST = 0U;
+static constexpr uint8_t MELODY_DOTTED = 0x80U;
+
+/*****************************************************************************/
+
+/* Functions */
+
+/**
+ * @brief Pitch (MIDI note number) of a note name in an octave (A4 = 69).
+ */
+constexpr uint8_t melody_pitch(const melody_note_name_t name,
+    const uint8_t octave)
+{
+    return static_cast<uint8_t>(((octave + 1U) * 12U) + name);
+}
+
+uint16_t melody_pitch_frequency(const uint8_t pitch);
+
+buzzer_tone_t melody_get_tone(const melody_t& melody, const uint8_t index);
+
+uint32_t melody_get_duration_ms(const melody_t& melody);
+
+/*****************************************************************************/
+
+/* Melodies */
+
+extern const melody_t MELODY_STARTUP;
+extern const melody_t MELODY_ALARM;
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* MELODY_H */
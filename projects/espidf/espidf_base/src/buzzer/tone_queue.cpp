@@ -0,0 +1,111 @@
+/**
+ * @file    tone_queue.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Lock-free single-producer/single-consumer buzzer tones queue.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "tone_queue.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Ring buffer index mask
+static constexpr uint8_t INDEX_MASK = ToneQueue::CAPACITY - 1U;
+
+static_assert((ToneQueue::CAPACITY & INDEX_MASK) == 0U,
+    "ToneQueue capacity must be a power of 2");
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details Producer side. The tone is stored before the tail is published
+ * (release), so the consumer never reads a half written tone.
+ */
+bool ToneQueue::push(const buzzer_tone_t& tone)
+{
+    uint8_t t = tail.load(std::memory_order_relaxed);
+
+    if (static_cast<uint8_t>(t - head.load(std::memory_order_acquire)) >=
+        CAPACITY)
+    {   return false;   }
+
+    tones[t & INDEX_MASK] = tone;
+    tail.store(static_cast<uint8_t>(t + 1U), std::memory_order_release);
+    return true;
+}
+
+/**
+ * @details Consumer side. The slot is released (head) after the tone has
+ * been copied out.
+ */
+bool ToneQueue::pop(buzzer_tone_t& tone)
+{
+    uint8_t h = head.load(std::memory_order_relaxed);
+
+    if (h == tail.load(std::memory_order_acquire))
+    {   return false;   }
+
+    tone = tones[h & INDEX_MASK];
+    head.store(static_cast<uint8_t>(h + 1U), std::memory_order_release);
+    return true;
+}
+
+/**
+ * @details Consumer side, drops all queued tones.
+ */
+void ToneQueue::clear()
+{
+    head.store(tail.load(std::memory_order_acquire),
+        std::memory_order_release);
+}
+
+bool ToneQueue::is_empty()
+{
+    return (get_size() == 0U);
+}
+
+uint8_t ToneQueue::get_size()
+{
+    return static_cast<uint8_t>(tail.load(std::memory_order_acquire) -
+        head.load(std::memory_order_acquire));
+}
+
+/*****************************************************************************/
@@ -0,0 +1,110 @@
+/**
+ * @file    tone_queue.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Lock-free single-producer/single-consumer buzzer tones queue.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef TONE_QUEUE_H
+#define TONE_QUEUE_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <atomic>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Data Types */
+
+struct melody_t;
+
+/**
+ * @brief Buzzer tone step: a tone (0 Hz for silence) followed by a gap of
+ * silence, or a whole melody if melody is not null.
+ */
+struct buzzer_tone_t
+{
+    uint16_t frequency;
+    uint16_t duration_ms;
+    uint16_t gap_ms;
+    const melody_t* melody;
+};
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @details Fixed capacity ring buffer where one producer (task or ISR)
+ * pushes and one consumer pops without locks: the producer only writes the
+ * tail index and the consumer only writes the head index.
+ */
+class ToneQueue
+{
+    public:
+
+        static constexpr uint8_t CAPACITY = 16U;
+
+        bool push(const buzzer_tone_t& tone);
+
+        bool pop(buzzer_tone_t& tone);
+
+        void clear();
+
+        bool is_empty();
+
+        uint8_t get_size();
+
+    /******************************************************************/
+
+    private:
+
+        // Free running indexes (the capacity divides their range)
+        std::atomic<uint8_t> head{0U};
+        std::atomic<uint8_t> tail{0U};
+
+        buzzer_tone_t tones[CAPACITY];
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* TONE_QUEUE_H */
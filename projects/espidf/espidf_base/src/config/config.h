@@ -75,6 +75,14 @@
 #define IO_LCD_BACKLIGHT 46
 #define IO_BUZZER 20
 
+// Touch Panel Interrupt Pin (set to the GPIO wired to FT6236 INT pin to
+// read the touch panel on interrupt; -1 to poll it periodically), it can
+// be set from build flags
+#if !defined(SET_IO_TOUCH_INT)
+    #define SET_IO_TOUCH_INT -1
+#endif
+#define IO_TOUCH_INT SET_IO_TOUCH_INT
+
 // I2C Port used for TouchPanel
 #define I2C_PORT_TOUCH I2C_NUM_0
 
@@ -113,10 +121,144 @@ namespace ns_const
     static constexpr uint32_t DEFAULT_UART_BAUD_RATE = 115200U;
 
     /**
-     * @brief I2C Frequency.
+     * @brief Fast boot: the screen is not cleared and the backlight is
+     * turned on once the first UI frame is sent, and the Buzzer and Touch
+     * Panel initializations run in parallel with the LVGL setup.
+     */
+    static constexpr bool FAST_BOOT = true;
+
+    /**
+     * @brief Play the startup melody once the boot ends (UI Task launched),
+     * instead of the Buzzer initialization beep.
+     */
+    static constexpr bool BUZZER_STARTUP_MELODY = true;
+
+    /**
+     * @brief Boot Task (fast boot parallel initializations) CPU Core (the
+     * UI Task one, not running yet).
+     */
+    static constexpr int BOOT_TASK_CORE = 1;
+
+    /**
+     * @brief Boot Task Stack Size (Bytes).
+     */
+    static constexpr uint32_t BOOT_TASK_STACK_SIZE = 4096U;
+
+    /**
+     * @brief Boot Task Priority.
+     */
+    static constexpr uint32_t BOOT_TASK_PRIORITY = 1U;
+
+    /**
+     * @brief I2C Frequency (bus default, for devices without own speed).
      */
     static constexpr uint32_t I2C_FREQUENCY_HZ = 100000UL;
 
+    /**
+     * @brief Touch Panel I2C Frequencies to probe at startup, fastest first
+     * (Fast-mode Plus and Fast-mode), falls back to I2C_FREQUENCY_HZ.
+     */
+    static constexpr uint32_t TOUCH_I2C_FREQUENCIES_HZ[] =
+        { 1000000UL, 400000UL };
+
+    /**
+     * @brief Main Task (peripherals management) maximum sleep time, when
+     * no management work is due (Serial console commands polling period).
+     */
+    static constexpr uint32_t MAIN_LOOP_MAX_SLEEP_MS = 100U;
+
+    /**
+     * @brief UI Task (LVGL render) CPU Core.
+     */
+    static constexpr int UI_TASK_CORE = 1;
+
+    /**
+     * @brief UI Task Stack Size (Bytes).
+     */
+    static constexpr uint32_t UI_TASK_STACK_SIZE = 8192U;
+
+    /**
+     * @brief UI Task Priority.
+     */
+    static constexpr uint32_t UI_TASK_PRIORITY = 2U;
+
+    /**
+     * @brief UI Update Messages Queue Size.
+     */
+    static constexpr uint32_t UI_QUEUE_SIZE = 8U;
+
+    /**
+     * @brief Touch Panel Read Period (polling mode).
+     */
+    static constexpr uint32_t TOUCH_READ_PERIOD_MS = 30U;
+
+    /**
+     * @brief Touch Panel Samples Queue Size.
+     */
+    static constexpr uint32_t TOUCH_QUEUE_SIZE = 8U;
+
+    /**
+     * @brief Touch Task (interrupt mode) CPU Core.
+     */
+    static constexpr int TOUCH_TASK_CORE = 0;
+
+    /**
+     * @brief Touch Task (interrupt mode) Stack Size (Bytes).
+     */
+    static constexpr uint32_t TOUCH_TASK_STACK_SIZE = 4096U;
+
+    /**
+     * @brief Touch Task (interrupt mode) Priority.
+     */
+    static constexpr uint32_t TOUCH_TASK_PRIORITY = 3U;
+
+    /**
+     * @brief Touch Task (interrupt mode) re-read timeout while pressed (in
+     * case a lift up interrupt is missed).
+     */
+    static constexpr uint32_t TOUCH_PRESSED_TIMEOUT_MS = 100U;
+
+    /**
+     * @brief Touch Panel I2C reads deadline (a sample that waited longer
+     * for the bus is discarded).
+     */
+    static constexpr uint32_t TOUCH_I2C_DEADLINE_MS = 20U;
+
+    /**
+     * @brief I2C Scheduler Task (bus owner) CPU Core.
+     */
+    static constexpr int I2C_TASK_CORE = 0;
+
+    /**
+     * @brief I2C Scheduler Task Stack Size (Bytes).
+     */
+    static constexpr uint32_t I2C_TASK_STACK_SIZE = 4096U;
+
+    /**
+     * @brief I2C Scheduler Task Priority.
+     */
+    static constexpr uint32_t I2C_TASK_PRIORITY = 4U;
+
+    /**
+     * @brief I2C Scheduler Transactions Queue Size (for each priority).
+     */
+    static constexpr uint32_t I2C_QUEUE_SIZE = 8U;
+
+    /**
+     * @brief Logger Task (log records output) CPU Core.
+     */
+    static constexpr int LOG_TASK_CORE = 0;
+
+    /**
+     * @brief Logger Task Stack Size (Bytes).
+     */
+    static constexpr uint32_t LOG_TASK_STACK_SIZE = 3072U;
+
+    /**
+     * @brief Logger Task Priority (lowest application one).
+     */
+    static constexpr uint32_t LOG_TASK_PRIORITY = 1U;
+
     /**
      * @brief Buzzer Minimum Frequency.
      */
@@ -131,6 +273,11 @@ namespace ns_const
      * @brief Buzzer Duty Cycle.
      */
     static constexpr const uint8_t BUZZER_DUTY_CYCLE = 50U;
+
+    /**
+     * @brief PWM Frequency Change Benchmark number of frequency steps.
+     */
+    static constexpr uint32_t PWM_BENCHMARK_STEPS = 200U;
 }
 
 /*****************************************************************************/
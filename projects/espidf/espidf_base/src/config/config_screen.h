@@ -45,10 +45,15 @@
 /* Libraries */
 
 // Standard C++ Libraries
+#include <cstddef>
 #include <cstdint>
 
 // Graphic Screen Driver
-#include <LovyanGFX.hpp>
+#if defined(NATIVE_BUILD)
+    #include "native/lgfx_native.h"
+#else
+    #include <LovyanGFX.hpp>
+#endif
 #include <lvgl.h>
 
 /*****************************************************************************/
@@ -72,6 +77,40 @@
 
 /*****************************************************************************/
 
+/* Data Types */
+
+/**
+ * @brief Screen render buffers placement and sizing strategies.
+ */
+enum screen_buffer_strategy_t
+{
+    // 1 buffer of 1/5 screen in internal DMA capable RAM
+    SCREEN_BUFFER_INTERNAL_SINGLE = 0,
+
+    // 2 buffers of 1/10 screen in internal DMA capable RAM (render and
+    // DMA transfer overlap)
+    SCREEN_BUFFER_INTERNAL_DOUBLE,
+
+    // 1 full screen buffer in PSRAM (no internal RAM cost)
+    SCREEN_BUFFER_PSRAM_FULL,
+
+    SCREEN_BUFFER_NUM_STRATEGIES
+};
+
+/**
+ * @brief LovyanGFX pixel type of the LVGL render buffers. With
+ * LV_COLOR_16_SWAP, LVGL renders RGB565 in the byte order that the panel
+ * bus expects, so LovyanGFX sends the buffers as they are, without any
+ * per-pixel conversion.
+ */
+#if LV_COLOR_16_SWAP
+    typedef lgfx::swap565_t screen_pixel_t;
+#else
+    typedef lgfx::rgb565_t screen_pixel_t;
+#endif
+
+/*****************************************************************************/
+
 /* Screen Configuration Constants */
 
 namespace ns_const
@@ -87,16 +126,39 @@ namespace ns_const
     static constexpr uint16_t SCREEN_HEIGHT = 320U;
 
     /**
-     * @brief Screen Buffer Size.
+     * @brief Screen Render Buffers Strategy used at startup.
+     */
+    static constexpr screen_buffer_strategy_t SCREEN_BUFFER_STRATEGY
+        = SCREEN_BUFFER_INTERNAL_DOUBLE;
+
+    /**
+     * @brief Number of frames rendered for each strategy by the screen
+     * buffers benchmark.
+     */
+    static constexpr uint32_t SCREEN_BENCHMARK_FRAMES = 30U;
+
+    /**
+     * @brief Cost of sending one more area to the screen, in pixels (LVGL
+     * area render and flush setup plus the ILI9488 column/page address and
+     * memory write commands, around 20us or 400 pixels on the 16-bit bus).
+     * Invalidated areas are merged when their bounding box extra pixels
+     * are cheaper than this.
+     */
+    static constexpr uint32_t SCREEN_AREA_WINDOW_COST_PX = 400U;
+
+    /**
+     * @brief Decoded Images Cache Budget (Bytes of decoded pixels, PSRAM).
      */
-    static constexpr uint32_t SCREEN_BUFFER_SIZE
-        = (SCREEN_WIDTH * SCREEN_HEIGHT / 5U);
+    static constexpr size_t SCREEN_IMG_CACHE_BUDGET_BYTES = 1024U * 1024U;
 }
 
 /*****************************************************************************/
 
 /* Screen Setup */
 
+// Native build uses the memory-backed LGFX stand-in (native/lgfx_native.h)
+#if !defined(NATIVE_BUILD)
+
 class LGFX : public lgfx::LGFX_Device
 {
     public:
@@ -160,6 +222,8 @@ class LGFX : public lgfx::LGFX_Device
         lgfx::Bus_Parallel16 _bus_instance;
 };
 
+#endif /* !NATIVE_BUILD */
+
 /*****************************************************************************/
 
 /* Include Guard Close */
@@ -40,8 +40,74 @@
 // Library Header
 #include "i2c.h"
 
+// Standard C++ Libraries
+#include <cstring>
+
 // ESP-IDF Framework
+#include "driver/gpio.h"
 #include "esp_err.h"
+#include "esp_rom_sys.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// I2C Port setup (to compute transaction timeouts and recover the bus)
+struct i2c_port_setup_t
+{
+    uint8_t io_sda;
+    uint8_t io_scl;
+    uint32_t frequency;
+    uint32_t current_frequency;
+    uint32_t recoveries;
+    bool installed;
+};
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Command Link buffer sizes for write and write-then-read transactions (the
+// links are built into a caller stack buffer, so transactions don't use the
+// heap)
+static constexpr size_t CMD_LINK_WRITE_SIZE = I2C_LINK_RECOMMENDED_SIZE(1);
+static constexpr size_t CMD_LINK_READ_SIZE = I2C_LINK_RECOMMENDED_SIZE(2);
+
+// Transaction timeout, as a multiple of the expected transfer time (with a
+// minimum that covers the driver and interrupts latency)
+static constexpr uint32_t TIMEOUT_TRANSFER_TIME_FACTOR = 4U;
+static constexpr uint32_t TIMEOUT_MIN_US = 1000U;
+
+// Bits transferred per byte (8 data + ACK) and per START/STOP conditions
+static constexpr uint32_t BITS_PER_BYTE = 9U;
+static constexpr uint32_t BITS_PER_CONDITION = 1U;
+
+// Number of reads that must be verified to accept a probed frequency
+static constexpr uint8_t PROBE_READS = 8U;
+
+// Bus Recovery: Max clock pulses to get a slave to release SDA (a full byte
+// plus ACK) and half SCL period (100 kHz)
+static constexpr uint8_t RECOVERY_CLOCK_PULSES = 9U;
+static constexpr uint32_t RECOVERY_HALF_PERIOD_US = 5U;
+
+/*****************************************************************************/
+
+/* In-Scope Functions */
+
+static esp_err_t port_config(const i2c_port_t i2c_port, const uint8_t io_sda,
+    const uint8_t io_scl, const uint32_t frequency);
+static esp_err_t port_install(const i2c_port_t i2c_port,
+    const uint32_t frequency);
+static esp_err_t transaction_run(const i2c_port_t i2c_port,
+    i2c_cmd_handle_t cmd, const size_t num_bytes,
+    const uint8_t num_conditions);
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// I2C Ports setup
+static i2c_port_setup_t port_setups[I2C_NUM_MAX];
 
 /*****************************************************************************/
 
@@ -50,29 +116,44 @@
 void i2c_setup(const i2c_port_t i2c_port, const uint8_t io_sda,
     const uint8_t io_scl, const uint32_t frequency)
 {
-    i2c_config_t i2c_config;
-    i2c_config.mode = I2C_MODE_MASTER;
-    i2c_config.sda_io_num = static_cast<int>(io_sda);
-    i2c_config.scl_io_num = static_cast<int>(io_scl);
-    i2c_config.sda_pullup_en = GPIO_PULLUP_ENABLE;
-    i2c_config.scl_pullup_en = GPIO_PULLUP_ENABLE;
-    i2c_config.master.clk_speed = frequency;
-    i2c_config.clk_flags = I2C_SCLK_SRC_FLAG_FOR_NOMAL;
-
-    ESP_ERROR_CHECK(i2c_param_config(i2c_port, &i2c_config));
-    ESP_ERROR_CHECK(i2c_driver_install(i2c_port, I2C_MODE_MASTER, 0U, 0U, 0));
+    port_setups[i2c_port].io_sda = io_sda;
+    port_setups[i2c_port].io_scl = io_scl;
+    port_setups[i2c_port].frequency = frequency;
+    port_setups[i2c_port].current_frequency = frequency;
+    ESP_ERROR_CHECK(port_install(i2c_port, frequency));
+    port_setups[i2c_port].installed = true;
 }
 
 bool i2c_write(const i2c_port_t i2c_port, const uint16_t slave_address,
     const uint8_t data_to_write)
 {
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    uint8_t cmd_buffer[CMD_LINK_WRITE_SIZE] = {0};
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(cmd_buffer,
+        sizeof(cmd_buffer));
     i2c_master_start(cmd);
     i2c_master_write_byte(cmd, (slave_address << 1) | I2C_MASTER_WRITE, true);
     i2c_master_write_byte(cmd, data_to_write, true);
     i2c_master_stop(cmd);
-    esp_err_t ret = i2c_master_cmd_begin(i2c_port, cmd, pdMS_TO_TICKS(1000));
-    i2c_cmd_link_delete(cmd);
+    esp_err_t ret = transaction_run(i2c_port, cmd, 2U, 2U);
+    i2c_cmd_link_delete_static(cmd);
+
+    return (ret == ESP_OK);
+}
+
+bool i2c_write_register(const i2c_port_t i2c_port,
+    const uint16_t slave_address, const uint8_t reg_address,
+    const uint8_t data_to_write)
+{
+    uint8_t cmd_buffer[CMD_LINK_WRITE_SIZE] = {0};
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(cmd_buffer,
+        sizeof(cmd_buffer));
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, (slave_address << 1) | I2C_MASTER_WRITE, true);
+    i2c_master_write_byte(cmd, reg_address, true);
+    i2c_master_write_byte(cmd, data_to_write, true);
+    i2c_master_stop(cmd);
+    esp_err_t ret = transaction_run(i2c_port, cmd, 3U, 2U);
+    i2c_cmd_link_delete_static(cmd);
 
     return (ret == ESP_OK);
 }
@@ -83,7 +164,9 @@ bool i2c_read_register(const i2c_port_t i2c_port, const uint16_t slave_address,
     *data_read = 0;
 
     // Write Command Request
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    uint8_t cmd_buffer[CMD_LINK_READ_SIZE] = {0};
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(cmd_buffer,
+        sizeof(cmd_buffer));
     i2c_master_start(cmd);
     i2c_master_write_byte(cmd, (slave_address << 1) | I2C_MASTER_WRITE, true);
     i2c_master_write_byte(cmd, reg_address, true);
@@ -95,10 +178,240 @@ bool i2c_read_register(const i2c_port_t i2c_port, const uint16_t slave_address,
     i2c_master_write_byte(cmd, (slave_address << 1) | I2C_MASTER_READ, true);
     i2c_master_read_byte(cmd, data_read, I2C_MASTER_NACK);
     i2c_master_stop(cmd);
-    esp_err_t ret = i2c_master_cmd_begin(i2c_port, cmd, pdMS_TO_TICKS(1000));
-    i2c_cmd_link_delete(cmd);
+    esp_err_t ret = transaction_run(i2c_port, cmd, 4U, 3U);
+    i2c_cmd_link_delete_static(cmd);
 
     return (ret == ESP_OK);
 }
 
+bool i2c_read_registers(const i2c_port_t i2c_port,
+    const uint16_t slave_address, const uint8_t reg_address,
+    uint8_t* data_read, const size_t length)
+{
+    if (length == 0U)
+    {   return false;   }
+    memset(data_read, 0, length);
+
+    // Write Command Request (first register address)
+    uint8_t cmd_buffer[CMD_LINK_READ_SIZE] = {0};
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(cmd_buffer,
+        sizeof(cmd_buffer));
+    i2c_master_start(cmd);
+    i2c_master_write_byte(cmd, (slave_address << 1) | I2C_MASTER_WRITE, true);
+    i2c_master_write_byte(cmd, reg_address, true);
+
+    // Keep Communication to get response
+    i2c_master_start(cmd);
+
+    // Read Response (slave auto-increments the register address, all bytes
+    // are ACK but the last one)
+    i2c_master_write_byte(cmd, (slave_address << 1) | I2C_MASTER_READ, true);
+    i2c_master_read(cmd, data_read, length, I2C_MASTER_LAST_NACK);
+    i2c_master_stop(cmd);
+    esp_err_t ret = transaction_run(i2c_port, cmd, 3U + length, 3U);
+    i2c_cmd_link_delete_static(cmd);
+
+    return (ret == ESP_OK);
+}
+
+/**
+ * @details Changes the port clock for next transactions (0 to go back to
+ * the i2c_setup() frequency), so each device can use its own speed.
+ */
+bool i2c_set_frequency(const i2c_port_t i2c_port, const uint32_t frequency)
+{
+    i2c_port_setup_t& setup = port_setups[i2c_port];
+    uint32_t new_frequency = (frequency == 0U) ? setup.frequency : frequency;
+
+    if (new_frequency == setup.current_frequency)
+    {   return true;   }
+    if (port_config(i2c_port, setup.io_sda, setup.io_scl, new_frequency)
+        != ESP_OK)
+    {   return false;   }
+    setup.current_frequency = new_frequency;
+
+    return true;
+}
+
+uint32_t i2c_get_frequency(const i2c_port_t i2c_port)
+{
+    return port_setups[i2c_port].current_frequency;
+}
+
+/**
+ * @details Tries the frequencies in the given order (fastest first), and
+ * takes the first one in which all the probe reads are verified. The port
+ * clock is not changed here, each probe read must request its transactions
+ * at the given frequency (i.e. through the I2C Scheduler with it in the
+ * device descriptor). The i2c_setup() frequency is returned if none of the
+ * frequencies works.
+ */
+uint32_t i2c_probe_frequency(const i2c_port_t i2c_port,
+    const uint32_t* frequencies, const uint8_t num_frequencies,
+    i2c_probe_callback_t probe_read)
+{
+    uint32_t probed_frequency = port_setups[i2c_port].frequency;
+
+    for (uint8_t i = 0U; i < num_frequencies; i++)
+    {
+        bool verified = true;
+        for (uint8_t n = 0U; (n < PROBE_READS) && verified; n++)
+        {   verified = probe_read(frequencies[i]);   }
+        if (verified)
+        {
+            probed_frequency = frequencies[i];
+            break;
+        }
+    }
+
+    return probed_frequency;
+}
+
+bool i2c_bus_is_ready(const i2c_port_t i2c_port)
+{
+    return port_setups[i2c_port].installed;
+}
+
+bool i2c_bus_is_stuck(const i2c_port_t i2c_port)
+{
+    gpio_num_t io_sda = static_cast<gpio_num_t>(port_setups[i2c_port].io_sda);
+
+    // Bus is idle between transactions, SDA must be released (high)
+    return (gpio_get_level(io_sda) == 0);
+}
+
+/**
+ * @details Takes the pins from the I2C controller and clocks SCL until the
+ * slave that holds SDA low finish its byte and releases it, then generates
+ * a STOP condition and sets up the I2C controller again. If the controller
+ * setup fails, the port is left not ready (see i2c_bus_is_ready()) and the
+ * next transaction tries to set it up again.
+ */
+bool i2c_bus_recover(const i2c_port_t i2c_port)
+{
+    i2c_port_setup_t& setup = port_setups[i2c_port];
+    gpio_num_t io_sda = static_cast<gpio_num_t>(setup.io_sda);
+    gpio_num_t io_scl = static_cast<gpio_num_t>(setup.io_scl);
+
+    setup.recoveries = setup.recoveries + 1U;
+    setup.installed = false;
+    i2c_driver_delete(i2c_port);
+    gpio_set_level(io_sda, 1U);
+    gpio_set_level(io_scl, 1U);
+    gpio_set_direction(io_sda, GPIO_MODE_INPUT_OUTPUT_OD);
+    gpio_set_direction(io_scl, GPIO_MODE_INPUT_OUTPUT_OD);
+    esp_rom_delay_us(RECOVERY_HALF_PERIOD_US);
+
+    // Clock pulses until SDA is released
+    for (uint8_t i = 0U; i < RECOVERY_CLOCK_PULSES; i++)
+    {
+        if (gpio_get_level(io_sda) == 1)
+        {   break;   }
+        gpio_set_level(io_scl, 0U);
+        esp_rom_delay_us(RECOVERY_HALF_PERIOD_US);
+        gpio_set_level(io_scl, 1U);
+        esp_rom_delay_us(RECOVERY_HALF_PERIOD_US);
+    }
+
+    // STOP condition (SDA rises while SCL is high)
+    gpio_set_level(io_scl, 0U);
+    esp_rom_delay_us(RECOVERY_HALF_PERIOD_US);
+    gpio_set_level(io_sda, 0U);
+    esp_rom_delay_us(RECOVERY_HALF_PERIOD_US);
+    gpio_set_level(io_scl, 1U);
+    esp_rom_delay_us(RECOVERY_HALF_PERIOD_US);
+    gpio_set_level(io_sda, 1U);
+    esp_rom_delay_us(RECOVERY_HALF_PERIOD_US);
+    bool released = (gpio_get_level(io_sda) == 1);
+
+    setup.current_frequency = setup.frequency;
+    if (port_install(i2c_port, setup.frequency) != ESP_OK)
+    {   return false;   }
+    setup.installed = true;
+
+    return released;
+}
+
+uint32_t i2c_bus_recoveries(const i2c_port_t i2c_port)
+{
+    return port_setups[i2c_port].recoveries;
+}
+
+/*****************************************************************************/
+
+/* Private Functions */
+
+static esp_err_t port_config(const i2c_port_t i2c_port, const uint8_t io_sda,
+    const uint8_t io_scl, const uint32_t frequency)
+{
+    i2c_config_t i2c_config;
+    i2c_config.mode = I2C_MODE_MASTER;
+    i2c_config.sda_io_num = static_cast<int>(io_sda);
+    i2c_config.scl_io_num = static_cast<int>(io_scl);
+    i2c_config.sda_pullup_en = GPIO_PULLUP_ENABLE;
+    i2c_config.scl_pullup_en = GPIO_PULLUP_ENABLE;
+    i2c_config.master.clk_speed = frequency;
+    i2c_config.clk_flags = I2C_SCLK_SRC_FLAG_FOR_NOMAL;
+
+    return i2c_param_config(i2c_port, &i2c_config);
+}
+
+/**
+ * @details Configures the port and installs its I2C driver, returning the
+ * error instead of aborting (so a bus recovery can fail safely).
+ */
+static esp_err_t port_install(const i2c_port_t i2c_port,
+    const uint32_t frequency)
+{
+    i2c_port_setup_t& setup = port_setups[i2c_port];
+
+    esp_err_t ret = port_config(i2c_port, setup.io_sda, setup.io_scl,
+        frequency);
+    if (ret != ESP_OK)
+    {   return ret;   }
+    return i2c_driver_install(i2c_port, I2C_MODE_MASTER, 0U, 0U, 0);
+}
+
+/**
+ * @details The transaction timeout is sized to its expected transfer time
+ * at the port frequency, so a faulty slave can't block the caller for long,
+ * and the bus is recovered if a slave is holding SDA after the failure.
+ */
+static esp_err_t transaction_run(const i2c_port_t i2c_port,
+    i2c_cmd_handle_t cmd, const size_t num_bytes,
+    const uint8_t num_conditions)
+{
+    i2c_port_setup_t& setup = port_setups[i2c_port];
+    uint32_t frequency = setup.current_frequency;
+
+    // I2C driver lost on a failed bus recovery, set it up again first
+    if (setup.installed == false)
+    {
+        if (port_install(i2c_port, frequency) != ESP_OK)
+        {   return ESP_ERR_INVALID_STATE;   }
+        setup.installed = true;
+    }
+
+    uint32_t bits = (num_bytes * BITS_PER_BYTE) +
+        (num_conditions * BITS_PER_CONDITION);
+    uint32_t timeout_us = TIMEOUT_MIN_US;
+    if (frequency > 0U)
+    {
+        uint32_t transfer_us = static_cast<uint32_t>(
+            (static_cast<uint64_t>(bits) * 1000000ULL) / frequency);
+        if ((transfer_us * TIMEOUT_TRANSFER_TIME_FACTOR) > timeout_us)
+        {   timeout_us = transfer_us * TIMEOUT_TRANSFER_TIME_FACTOR;   }
+    }
+
+    // Round up to ticks, plus one as the current tick is partially elapsed
+    uint32_t tick_us = portTICK_PERIOD_MS * 1000U;
+    TickType_t timeout_ticks = ((timeout_us + tick_us - 1U) / tick_us) + 1U;
+
+    esp_err_t ret = i2c_master_cmd_begin(i2c_port, cmd, timeout_ticks);
+    if ( (ret != ESP_OK) && i2c_bus_is_stuck(i2c_port) )
+    {   i2c_bus_recover(i2c_port);   }
+
+    return ret;
+}
+
 /*****************************************************************************/
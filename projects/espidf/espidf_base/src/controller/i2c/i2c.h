@@ -45,6 +45,7 @@
 /* Libraries */
 
 // Standard C++ Libraries
+#include <cstddef>
 #include <cstdint>
 
 // ESP-IDF Framework
@@ -52,6 +53,14 @@
 
 /*****************************************************************************/
 
+/* Data Types */
+
+// I2C Frequency Probe Callback (reads and verifies some known registers of
+// the device, requesting the transactions at the given frequency)
+typedef bool (*i2c_probe_callback_t)(const uint32_t frequency);
+
+/*****************************************************************************/
+
 /* Functions */
 
 void i2c_setup(const i2c_port_t i2c_port, const uint8_t io_sda,
@@ -60,9 +69,33 @@ void i2c_setup(const i2c_port_t i2c_port, const uint8_t io_sda,
 bool i2c_write(const i2c_port_t i2c_port, const uint16_t slave_address,
     const uint8_t data_to_write);
 
+bool i2c_write_register(const i2c_port_t i2c_port,
+    const uint16_t slave_address, const uint8_t reg_address,
+    const uint8_t data_to_write);
+
 bool i2c_read_register(const i2c_port_t i2c_port, const uint16_t slave_address,
     const uint8_t reg_address, uint8_t* data_read);
 
+bool i2c_read_registers(const i2c_port_t i2c_port,
+    const uint16_t slave_address, const uint8_t reg_address,
+    uint8_t* data_read, const size_t length);
+
+bool i2c_set_frequency(const i2c_port_t i2c_port, const uint32_t frequency);
+
+uint32_t i2c_get_frequency(const i2c_port_t i2c_port);
+
+uint32_t i2c_probe_frequency(const i2c_port_t i2c_port,
+    const uint32_t* frequencies, const uint8_t num_frequencies,
+    i2c_probe_callback_t probe_read);
+
+bool i2c_bus_is_ready(const i2c_port_t i2c_port);
+
+bool i2c_bus_is_stuck(const i2c_port_t i2c_port);
+
+bool i2c_bus_recover(const i2c_port_t i2c_port);
+
+uint32_t i2c_bus_recoveries(const i2c_port_t i2c_port);
+
 /*****************************************************************************/
 
 /* Include Guard Close */
@@ -0,0 +1,462 @@
+/**
+ * @file    i2c_scheduler.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * I2C bus transactions scheduler (bus owner task with per-device priorities and deadlines).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "i2c_scheduler.h"
+
+// Standard C++ Libraries
+#include <cstdio>
+#include <cstring>
+
+// FreeRTOS Library
+#include "freertos/semphr.h"
+
+// ESP-IDF Framework
+#include "esp_timer.h"
+
+// I2C Controller
+#include "i2c.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Circuit Breaker: consecutive failures to stop using a device, and backoff
+// time range (doubled on each failed retry)
+static constexpr uint8_t BREAKER_FAILURES = 3U;
+static constexpr uint32_t BREAKER_BACKOFF_MIN_MS = 100U;
+static constexpr uint32_t BREAKER_BACKOFF_MAX_MS = 3200U;
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// Synchronous transaction wait context
+struct i2c_sync_t
+{
+    SemaphoreHandle_t done;
+    i2c_result_t result;
+};
+
+/*****************************************************************************/
+
+/* In-Scope Functions */
+
+static void sync_callback(const i2c_result_t result, void* arg);
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+I2CScheduler::I2CScheduler(const i2c_port_t i2c_port)
+{
+    this->i2c_port = i2c_port;
+    for (uint8_t i = 0U; i < I2C_NUM_PRIORITIES; i++)
+    {   queues[i] = nullptr;   }
+    task_handle = nullptr;
+    num_breakers = 0U;
+    portMUX_INITIALIZE(&state_lock);
+    reset_stats();
+}
+
+/**
+ * @details If the scheduler task can't be launched, transactions are run
+ * directly in the requester task context.
+ */
+bool I2CScheduler::init(const uint32_t queue_size, const int core,
+    const uint32_t stack_size, const uint32_t priority)
+{
+    for (uint8_t i = 0U; i < I2C_NUM_PRIORITIES; i++)
+    {
+        queues[i] = xQueueCreate(queue_size, sizeof(i2c_request_t));
+        if (queues[i] == nullptr)
+        {   return false;   }
+    }
+
+    if (xTaskCreatePinnedToCore(task_scheduler, "task_i2c", stack_size,
+        this, priority, &task_handle, core) != pdPASS)
+    {
+        task_handle = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @details Asynchronous read, data_read buffer must be kept valid until the
+ * callback is called.
+ */
+bool I2CScheduler::read_registers(const i2c_device_t& device,
+    const uint8_t reg_address, uint8_t* data_read, const size_t length,
+    i2c_callback_t callback, void* arg)
+{
+    i2c_request_t req;
+    req.device = device;
+    req.reg_address = reg_address;
+    req.write = false;
+    req.value = 0U;
+    req.data = data_read;
+    req.length = length;
+    req.callback = callback;
+    req.callback_arg = arg;
+    return request(req);
+}
+
+bool I2CScheduler::write_register(const i2c_device_t& device,
+    const uint8_t reg_address, const uint8_t data_to_write,
+    i2c_callback_t callback, void* arg)
+{
+    i2c_request_t req;
+    req.device = device;
+    req.reg_address = reg_address;
+    req.write = true;
+    req.value = data_to_write;
+    req.data = nullptr;
+    req.length = 1U;
+    req.callback = callback;
+    req.callback_arg = arg;
+    return request(req);
+}
+
+/**
+ * @details Blocks the caller until the transaction is completed (the wait
+ * semaphore is in the caller stack, so this doesn't use the heap).
+ */
+i2c_result_t I2CScheduler::read_registers_sync(const i2c_device_t& device,
+    const uint8_t reg_address, uint8_t* data_read, const size_t length)
+{
+    StaticSemaphore_t done_buffer;
+    i2c_sync_t sync;
+    sync.done = xSemaphoreCreateBinaryStatic(&done_buffer);
+    sync.result = I2C_RESULT_FAIL;
+
+    if (read_registers(device, reg_address, data_read, length,
+        sync_callback, &sync) == false)
+    {   return I2C_RESULT_REJECTED;   }
+    xSemaphoreTake(sync.done, portMAX_DELAY);
+
+    return sync.result;
+}
+
+i2c_result_t I2CScheduler::write_register_sync(const i2c_device_t& device,
+    const uint8_t reg_address, const uint8_t data_to_write)
+{
+    StaticSemaphore_t done_buffer;
+    i2c_sync_t sync;
+    sync.done = xSemaphoreCreateBinaryStatic(&done_buffer);
+    sync.result = I2C_RESULT_FAIL;
+
+    if (write_register(device, reg_address, data_to_write,
+        sync_callback, &sync) == false)
+    {   return I2C_RESULT_REJECTED;   }
+    xSemaphoreTake(sync.done, portMAX_DELAY);
+
+    return sync.result;
+}
+
+uint32_t I2CScheduler::get_queue_depth()
+{
+    uint32_t depth = 0U;
+
+    for (uint8_t i = 0U; i < I2C_NUM_PRIORITIES; i++)
+    {
+        if (queues[i] != nullptr)
+        {   depth = depth + uxQueueMessagesWaiting(queues[i]);   }
+    }
+
+    return depth;
+}
+
+/**
+ * @details Snapshot taken in a critical section, so its 64-bit fields are
+ * not torn by an update from another core.
+ */
+I2CScheduler::stats_t I2CScheduler::get_stats()
+{
+    stats_t snapshot;
+
+    portENTER_CRITICAL(&state_lock);
+    snapshot = stats;
+    portEXIT_CRITICAL(&state_lock);
+
+    return snapshot;
+}
+
+void I2CScheduler::reset_stats()
+{
+    int64_t t_now_us = esp_timer_get_time();
+
+    portENTER_CRITICAL(&state_lock);
+    memset(&stats, 0, sizeof(stats));
+    stats.t_start_us = t_now_us;
+    portEXIT_CRITICAL(&state_lock);
+}
+
+void I2CScheduler::dump()
+{
+    stats_t s = get_stats();
+    uint32_t transactions = s.completed + s.failed + s.expired;
+    int64_t t_elapsed_us = esp_timer_get_time() - s.t_start_us;
+
+    printf("\n[I2C Scheduler] Transactions: %lu (%lu failed, %lu expired, "
+        "%lu rejected, %lu backoff)\n", (unsigned long)(transactions),
+        (unsigned long)(s.failed), (unsigned long)(s.expired),
+        (unsigned long)(s.rejected), (unsigned long)(s.backoff));
+    printf("  Bus recoveries: %lu\n",
+        (unsigned long)(i2c_bus_recoveries(i2c_port)));
+    printf("  Queue depth: %lu (max %lu)\n",
+        (unsigned long)(get_queue_depth()),
+        (unsigned long)(s.queue_depth_max));
+    if (transactions > 0U)
+    {
+        printf("  Wait time: avg %lu us, max %lu us\n",
+            (unsigned long)(s.wait_us_total / transactions),
+            (unsigned long)(s.wait_us_max));
+    }
+    if (t_elapsed_us > 0)
+    {
+        printf("  Bus utilization: %lu.%02lu %%\n",
+            (unsigned long)((s.busy_us * 100U) / t_elapsed_us),
+            (unsigned long)(((s.busy_us * 10000U) / t_elapsed_us) % 100U));
+    }
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details The scheduler task is notified once for each queued request, and
+ * always takes the highest priority pending one, so touch transactions go
+ * ahead of bulk ones between transactions.
+ */
+void I2CScheduler::task_scheduler(void* arg)
+{
+    I2CScheduler* scheduler = static_cast<I2CScheduler*>(arg);
+    i2c_request_t req;
+
+    while (1)
+    {
+        ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+        for (uint8_t i = 0U; i < I2C_NUM_PRIORITIES; i++)
+        {
+            if (xQueueReceive(scheduler->queues[i], &req, 0) == pdPASS)
+            {
+                scheduler->process(req);
+                break;
+            }
+        }
+    }
+}
+
+bool I2CScheduler::request(i2c_request_t& req)
+{
+    req.t_request_us = esp_timer_get_time();
+
+    // Failing device, answer now without waiting for the bus
+    if (breaker_is_open(req.device.address))
+    {
+        portENTER_CRITICAL(&state_lock);
+        stats.backoff = stats.backoff + 1U;
+        portEXIT_CRITICAL(&state_lock);
+        if (req.callback != nullptr)
+        {   req.callback(I2C_RESULT_BACKOFF, req.callback_arg);   }
+        return true;
+    }
+
+    // No scheduler task, run it now
+    if (task_handle == nullptr)
+    {
+        process(req);
+        return true;
+    }
+
+    if ( (req.device.priority >= I2C_NUM_PRIORITIES) ||
+         (xQueueSend(queues[req.device.priority], &req, 0) != pdPASS) )
+    {
+        portENTER_CRITICAL(&state_lock);
+        stats.rejected = stats.rejected + 1U;
+        portEXIT_CRITICAL(&state_lock);
+        return false;
+    }
+    uint32_t depth = get_queue_depth();
+    portENTER_CRITICAL(&state_lock);
+    if (depth > stats.queue_depth_max)
+    {   stats.queue_depth_max = depth;   }
+    portEXIT_CRITICAL(&state_lock);
+    xTaskNotifyGive(task_handle);
+
+    return true;
+}
+
+void I2CScheduler::process(i2c_request_t& req)
+{
+    i2c_result_t result = I2C_RESULT_EXPIRED;
+    int64_t t_start_us = esp_timer_get_time();
+    uint32_t wait_us = static_cast<uint32_t>(t_start_us - req.t_request_us);
+    uint64_t busy_us = 0U;
+
+    // Only if the requester is still waiting for it (don't waste bus time)
+    if ( (req.device.deadline_ms == 0U) ||
+         (wait_us <= (req.device.deadline_ms * 1000U)) )
+    {
+        // Bus clock at the device speed
+        bool ok = i2c_set_frequency(i2c_port, req.device.frequency);
+        if (ok && req.write)
+        {
+            ok = i2c_write_register(i2c_port, req.device.address,
+                req.reg_address, req.value);
+        }
+        else if (ok)
+        {
+            ok = i2c_read_registers(i2c_port, req.device.address,
+                req.reg_address, req.data, req.length);
+        }
+        busy_us = static_cast<uint64_t>(esp_timer_get_time() - t_start_us);
+        result = (ok) ? I2C_RESULT_OK : I2C_RESULT_FAIL;
+        breaker_update(req.device.address, ok, i2c_bus_is_ready(i2c_port));
+    }
+
+    portENTER_CRITICAL(&state_lock);
+    stats.wait_us_total = stats.wait_us_total + wait_us;
+    if (wait_us > stats.wait_us_max)
+    {   stats.wait_us_max = wait_us;   }
+    stats.busy_us = stats.busy_us + busy_us;
+    if (result == I2C_RESULT_OK)
+    {   stats.completed = stats.completed + 1U;   }
+    else if (result == I2C_RESULT_FAIL)
+    {   stats.failed = stats.failed + 1U;   }
+    else
+    {   stats.expired = stats.expired + 1U;   }
+    portEXIT_CRITICAL(&state_lock);
+
+    if (req.callback != nullptr)
+    {   req.callback(result, req.callback_arg);   }
+}
+
+/*****************************************************************************/
+
+/* Private Methods - Circuit Breaker */
+
+bool I2CScheduler::breaker_is_open(const uint16_t address)
+{
+    bool open = false;
+    int64_t t_now_us = esp_timer_get_time();
+
+    portENTER_CRITICAL(&state_lock);
+    for (uint8_t i = 0U; i < num_breakers; i++)
+    {
+        if (breakers[i].address != address)
+        {   continue;   }
+        open = ( (breakers[i].failures >= BREAKER_FAILURES) &&
+                 (t_now_us < breakers[i].t_retry_us) );
+        break;
+    }
+    portEXIT_CRITICAL(&state_lock);
+
+    return open;
+}
+
+/**
+ * @details Once the backoff time is elapsed, next transaction goes to the
+ * bus, if it fails the breaker opens again with double backoff time. If the
+ * bus is not ready (failed recovery) the breaker opens at once.
+ */
+void I2CScheduler::breaker_update(const uint16_t address, const bool success,
+    const bool bus_ready)
+{
+    int64_t t_now_us = esp_timer_get_time();
+    breaker_t* breaker = nullptr;
+
+    portENTER_CRITICAL(&state_lock);
+    for (uint8_t i = 0U; i < num_breakers; i++)
+    {
+        if (breakers[i].address == address)
+        {   breaker = &breakers[i];   break;   }
+    }
+    if ( (breaker == nullptr) && (num_breakers < MAX_BREAKERS) )
+    {
+        breaker = &breakers[num_breakers];
+        breaker->address = address;
+        breaker->failures = 0U;
+        breaker->backoff_ms = BREAKER_BACKOFF_MIN_MS;
+        breaker->t_retry_us = 0;
+        num_breakers = num_breakers + 1U;
+    }
+
+    if (breaker != nullptr)
+    {
+        if (success)
+        {
+            breaker->failures = 0U;
+            breaker->backoff_ms = BREAKER_BACKOFF_MIN_MS;
+        }
+        else
+        {
+            if (bus_ready == false)
+            {   breaker->failures = BREAKER_FAILURES;   }
+            else if (breaker->failures < BREAKER_FAILURES)
+            {   breaker->failures = breaker->failures + 1U;   }
+            if (breaker->failures >= BREAKER_FAILURES)
+            {
+                breaker->t_retry_us = t_now_us +
+                    (static_cast<int64_t>(breaker->backoff_ms) * 1000LL);
+                breaker->backoff_ms = breaker->backoff_ms * 2U;
+                if (breaker->backoff_ms > BREAKER_BACKOFF_MAX_MS)
+                {   breaker->backoff_ms = BREAKER_BACKOFF_MAX_MS;   }
+            }
+        }
+    }
+    portEXIT_CRITICAL(&state_lock);
+}
+
+/*****************************************************************************/
+
+/* Private Functions - Synchronous Transactions */
+
+static void sync_callback(const i2c_result_t result, void* arg)
+{
+    i2c_sync_t* sync = static_cast<i2c_sync_t*>(arg);
+    sync->result = result;
+    xSemaphoreGive(sync->done);
+}
+
+/*****************************************************************************/
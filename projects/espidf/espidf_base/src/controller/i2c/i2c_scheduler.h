@@ -0,0 +1,227 @@
+/**
+ * @file    i2c_scheduler.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * I2C bus transactions scheduler (bus owner task with per-device priorities and deadlines).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef CONTROLLER_I2C_SCHEDULER_H
+#define CONTROLLER_I2C_SCHEDULER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+// FreeRTOS Library
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+// ESP-IDF Framework
+#include "driver/i2c.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief I2C transaction priorities (lower value, higher priority).
+ */
+enum i2c_priority_t
+{
+    I2C_PRIORITY_TOUCH = 0,
+    I2C_PRIORITY_NORMAL,
+    I2C_PRIORITY_BULK,
+    I2C_NUM_PRIORITIES
+};
+
+/**
+ * @brief I2C transaction results.
+ */
+enum i2c_result_t
+{
+    I2C_RESULT_OK = 0,
+    I2C_RESULT_FAIL,
+    I2C_RESULT_EXPIRED,
+    I2C_RESULT_REJECTED,
+    I2C_RESULT_BACKOFF
+};
+
+/**
+ * @brief I2C device of the bus (transactions priority, deadline since they
+ * are requested, 0 for no deadline, and bus clock frequency, 0 for the bus
+ * setup one).
+ */
+struct i2c_device_t
+{
+    uint16_t address;
+    i2c_priority_t priority;
+    uint32_t deadline_ms;
+    uint32_t frequency;
+};
+
+/**
+ * @brief I2C transaction completion callback (called from the scheduler
+ * task).
+ */
+typedef void (*i2c_callback_t)(const i2c_result_t result, void* arg);
+
+/**
+ * @brief I2C transaction request.
+ */
+struct i2c_request_t
+{
+    i2c_device_t device;
+    uint8_t reg_address;
+    bool write;
+    uint8_t value;
+    uint8_t* data;
+    size_t length;
+    int64_t t_request_us;
+    i2c_callback_t callback;
+    void* callback_arg;
+};
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+class I2CScheduler
+{
+    public:
+
+        /**
+         * @brief Scheduler statistics.
+         */
+        struct stats_t
+        {
+            uint32_t completed;
+            uint32_t failed;
+            uint32_t expired;
+            uint32_t rejected;
+            uint32_t backoff;
+            uint32_t queue_depth_max;
+            uint64_t wait_us_total;
+            uint32_t wait_us_max;
+            uint64_t busy_us;
+            int64_t t_start_us;
+        };
+
+        I2CScheduler(const i2c_port_t i2c_port);
+
+        bool init(const uint32_t queue_size, const int core,
+            const uint32_t stack_size, const uint32_t priority);
+
+        bool read_registers(const i2c_device_t& device,
+            const uint8_t reg_address, uint8_t* data_read,
+            const size_t length, i2c_callback_t callback, void* arg);
+
+        bool write_register(const i2c_device_t& device,
+            const uint8_t reg_address, const uint8_t data_to_write,
+            i2c_callback_t callback, void* arg);
+
+        i2c_result_t read_registers_sync(const i2c_device_t& device,
+            const uint8_t reg_address, uint8_t* data_read,
+            const size_t length);
+
+        i2c_result_t write_register_sync(const i2c_device_t& device,
+            const uint8_t reg_address, const uint8_t data_to_write);
+
+        uint32_t get_queue_depth();
+
+        stats_t get_stats();
+
+        void reset_stats();
+
+        void dump();
+
+    /******************************************************************/
+
+    private:
+
+        /**
+         * @brief Device circuit breaker (after some consecutive failures,
+         * device transactions are answered with I2C_RESULT_BACKOFF without
+         * using the bus, for an increasing backoff time).
+         */
+        struct breaker_t
+        {
+            uint16_t address;
+            uint8_t failures;
+            uint32_t backoff_ms;
+            int64_t t_retry_us;
+        };
+
+        /**
+         * @brief Max number of devices with circuit breaker.
+         */
+        static constexpr uint8_t MAX_BREAKERS = 8U;
+
+        i2c_port_t i2c_port;
+        QueueHandle_t queues[I2C_NUM_PRIORITIES];
+        TaskHandle_t task_handle;
+        stats_t stats;
+        breaker_t breakers[MAX_BREAKERS];
+        uint8_t num_breakers;
+
+        /**
+         * @brief Lock of the breakers and the stats (updated from the
+         * scheduler task, or from the requesters without it, and read or
+         * reset from any task).
+         */
+        portMUX_TYPE state_lock;
+
+        static void task_scheduler(void* arg);
+
+        bool request(i2c_request_t& request);
+
+        void process(i2c_request_t& request);
+
+        bool breaker_is_open(const uint16_t address);
+
+        void breaker_update(const uint16_t address, const bool success,
+            const bool bus_ready);
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* CONTROLLER_I2C_SCHEDULER_H */
@@ -40,12 +40,19 @@
 // Library Header
 #include "pwm.h"
 
+// Standard C++ Libraries
+#include <cstdio>
+
 // ESP-IDF Framework
 #include "driver/ledc.h"
 #include "esp_err.h"
 //#include "esp32-hal.h"
 #include "soc/soc_caps.h"
 
+// FreeRTOS Libraries
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
 /*****************************************************************************/
 
 /* Defines */
@@ -67,77 +74,123 @@
 
 #define LEDC_MAX_BIT_WIDTH      SOC_LEDC_TIMER_BIT_WIDTH
 
+// LEDC Channels and Timers per Group
+#define LEDC_GROUP_CHANNELS     (8)
+#define LEDC_GROUP_TIMERS       (4)
+
+// LEDC Timers
+#define LEDC_TIMERS             (LEDC_CHANNELS / 2)
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// LEDC Timer State (users: number of channels using it, 0 if free)
+struct ledc_timer_state_t
+{
+    uint8_t users;
+    bool exclusive;
+    uint8_t resolution;
+    uint32_t requested_freq;
+    uint32_t freq;
+};
+
+// LEDC Channel State
+struct ledc_channel_state_t
+{
+    bool used;
+    uint8_t timer;
+};
+
+/*****************************************************************************/
+
+/* In-Scope Functions */
+
+static SemaphoreHandle_t state_lock();
+static int8_t channel_alloc(int8_t chan, int8_t pin, uint32_t freq,
+    uint8_t bit_num, bool own_timer);
+static uint32_t timer_change_frequency(uint8_t chan, uint32_t freq);
+static int8_t channel_find_free(int8_t chan);
+static int8_t timer_find(uint8_t group, uint32_t freq, uint8_t bit_num,
+    bool own_timer);
+
 /*****************************************************************************/
 
 /* In-Scope Attributes */
 
-/* LEDC Chan to Group/Channel/Timer Mapping
- * - ledc: 0  => Group: 0, Channel: 0, Timer: 0
- * - ledc: 1  => Group: 0, Channel: 1, Timer: 0
- * - ledc: 2  => Group: 0, Channel: 2, Timer: 1
- * - ledc: 3  => Group: 0, Channel: 3, Timer: 1
- * - ledc: 4  => Group: 0, Channel: 4, Timer: 2
- * - ledc: 5  => Group: 0, Channel: 5, Timer: 2
- * - ledc: 6  => Group: 0, Channel: 6, Timer: 3
- * - ledc: 7  => Group: 0, Channel: 7, Timer: 3
- * - ledc: 8  => Group: 1, Channel: 0, Timer: 0
- * - ledc: 9  => Group: 1, Channel: 1, Timer: 0
- * - ledc: 10 => Group: 1, Channel: 2, Timer: 1
- * - ledc: 11 => Group: 1, Channel: 3, Timer: 1
- * - ledc: 12 => Group: 1, Channel: 4, Timer: 2
- * - ledc: 13 => Group: 1, Channel: 5, Timer: 2
- * - ledc: 14 => Group: 1, Channel: 6, Timer: 3
- * - ledc: 15 => Group: 1, Channel: 7, Timer: 3
+/* LEDC Chan to Group/Channel Mapping, and Timer Index to Group/Timer
+ * - ledc: 0..7   => Group: 0, Channel: 0..7 (Timers: 0..3)
+ * - ledc: 8..15  => Group: 1, Channel: 0..7 (Timers: 4..7)
+ * A channel can use any timer of its group, assigned by ledc_alloc().
  */
-uint8_t channels_resolution[LEDC_CHANNELS] = {0};
+static ledc_channel_state_t channels_state[LEDC_CHANNELS] = {};
+static ledc_timer_state_t timers_state[LEDC_TIMERS] = {};
 
 /*****************************************************************************/
 
 /* Public Functions */
 
-uint32_t ledc_setup(uint8_t chan, uint32_t freq, uint8_t bit_num)
+/**
+ * @details Allocates the requested channel (or the first free one with
+ * LEDC_ANY_CHANNEL) and a timer of its group for it: a timer already
+ * running at the same frequency and resolution is shared, unless the
+ * channel needs its own timer (to change its frequency), or a free timer
+ * is configured. Returns the channel, or -1 if the channel is in use or
+ * there is no timer for it (requests never take over other users
+ * channels or timers).
+ */
+int8_t ledc_alloc(int8_t chan, int8_t pin, uint32_t freq, uint8_t bit_num,
+    bool own_timer)
 {
-    if (chan >= LEDC_CHANNELS || bit_num > LEDC_MAX_BIT_WIDTH)
-    {   return 0U;   }
-
-    ledc_mode_t group = static_cast<ledc_mode_t>(chan / 8U);
-    ledc_timer_t timer = static_cast<ledc_timer_t>((chan / 2U) % 4U);
+    if ( (chan < LEDC_ANY_CHANNEL) || (chan >= LEDC_CHANNELS) ||
+         (bit_num > LEDC_MAX_BIT_WIDTH) || (freq == 0U) )
+    {   return -1;   }
 
-    static ledc_timer_config_t ledc_timer;
-    ledc_timer.speed_mode = group;
-    ledc_timer.timer_num = timer;
-    ledc_timer.duty_resolution = static_cast<ledc_timer_bit_t>(bit_num);
-    ledc_timer.freq_hz = freq;
-    ledc_timer.clk_cfg = LEDC_DEFAULT_CLK;
-
-    if (ledc_timer_config(&ledc_timer) != ESP_OK)
-    {   return 0U;   }
+    xSemaphoreTake(state_lock(), portMAX_DELAY);
+    chan = channel_alloc(chan, pin, freq, bit_num, own_timer);
+    xSemaphoreGive(state_lock());
 
-    channels_resolution[chan] = bit_num;
-    return ledc_get_freq(group, timer);
+    return chan;
 }
 
-void ledc_attach_pin(uint8_t pin, uint8_t chan)
+/**
+ * @details Stops the channel output and releases it, and its timer if no
+ * other channel uses it.
+ */
+void ledc_free(uint8_t chan)
 {
-    if(chan >= LEDC_CHANNELS)
+    if (chan >= LEDC_CHANNELS)
     {   return;   }
 
-    ledc_channel_t channel = static_cast<ledc_channel_t>(chan % 8U);
-    ledc_mode_t group = static_cast<ledc_mode_t>(chan / 8U);
-    ledc_timer_t timer = static_cast<ledc_timer_t>((chan / 2U) % 4U);
+    xSemaphoreTake(state_lock(), portMAX_DELAY);
+    if (channels_state[chan].used)
+    {
+        ledc_stop(static_cast<ledc_mode_t>(chan / LEDC_GROUP_CHANNELS),
+            static_cast<ledc_channel_t>(chan % LEDC_GROUP_CHANNELS), 0U);
+        ledc_timer_state_t* timer_state =
+            &timers_state[channels_state[chan].timer];
+        timer_state->users = timer_state->users - 1U;
+        channels_state[chan].used = false;
+    }
+    xSemaphoreGive(state_lock());
+}
 
-    uint32_t duty = ledc_get_duty(group, channel);
+/**
+ * @details Fast path for frequency changes (i.e. buzzer tones): only the
+ * timer clock divider is updated (ledc_set_freq()), keeping its clock
+ * source and resolution, and nothing is done if the frequency is the same.
+ * Rejected (0) if the channel timer is shared with other channels.
+ */
+uint32_t ledc_change_frequency(uint8_t chan, uint32_t freq)
+{
+    if (chan >= LEDC_CHANNELS)
+    {   return 0U;   }
 
-    static ledc_channel_config_t ledc_channel;
-    ledc_channel.speed_mode = group;
-    ledc_channel.channel = channel;
-    ledc_channel.timer_sel = timer;
-    ledc_channel.intr_type = LEDC_INTR_DISABLE;
-    ledc_channel.gpio_num = pin;
-    ledc_channel.duty = duty;
-    ledc_channel.hpoint = 0;
+    xSemaphoreTake(state_lock(), portMAX_DELAY);
+    uint32_t new_freq = timer_change_frequency(chan, freq);
+    xSemaphoreGive(state_lock());
 
-    ledc_channel_config(&ledc_channel);
+    return new_freq;
 }
 
 void ledc_write(uint8_t chan, uint32_t duty)
@@ -145,17 +198,224 @@ void ledc_write(uint8_t chan, uint32_t duty)
     if (chan >= LEDC_CHANNELS)
     {   return;   }
 
-    ledc_channel_t channel = static_cast<ledc_channel_t>(chan % 8U);
-    ledc_mode_t group = static_cast<ledc_mode_t>(chan / 8U);
+    xSemaphoreTake(state_lock(), portMAX_DELAY);
+    if (channels_state[chan].used)
+    {
+        ledc_channel_t channel = static_cast<ledc_channel_t>(
+            chan % LEDC_GROUP_CHANNELS);
+        ledc_mode_t group = static_cast<ledc_mode_t>(
+            chan / LEDC_GROUP_CHANNELS);
+        uint8_t resolution =
+            timers_state[channels_state[chan].timer].resolution;
+
+        //Fixing if all bits in resolution is set = LEDC FULL ON
+        uint32_t max_duty = (1 << resolution) - 1;
+
+        if ((duty == max_duty) && (max_duty != 1))
+        {   duty = max_duty + 1;   }
+
+        ledc_set_duty(group, channel, duty);
+        ledc_update_duty(group, channel);
+    }
+    xSemaphoreGive(state_lock());
+}
+
+ledc_usage_t ledc_get_usage()
+{
+    ledc_usage_t usage = { 0U, LEDC_CHANNELS, 0U, LEDC_TIMERS };
+
+    xSemaphoreTake(state_lock(), portMAX_DELAY);
+    for (uint8_t i = 0U; i < LEDC_CHANNELS; i++)
+    {
+        if (channels_state[i].used)
+        {   usage.channels_used = usage.channels_used + 1U;   }
+    }
+    for (uint8_t i = 0U; i < LEDC_TIMERS; i++)
+    {
+        if (timers_state[i].users > 0U)
+        {   usage.timers_used = usage.timers_used + 1U;   }
+    }
+    xSemaphoreGive(state_lock());
+
+    return usage;
+}
+
+void ledc_dump()
+{
+    ledc_usage_t usage = ledc_get_usage();
+    ledc_timer_state_t timers[LEDC_TIMERS];
+
+    // Print a copy, to not hold the lock while printing
+    xSemaphoreTake(state_lock(), portMAX_DELAY);
+    for (uint8_t i = 0U; i < LEDC_TIMERS; i++)
+    {   timers[i] = timers_state[i];   }
+    xSemaphoreGive(state_lock());
+
+    printf("\n[PWM] Channels %u/%u, Timers %u/%u\n",
+        usage.channels_used, usage.channels_total, usage.timers_used,
+        usage.timers_total);
+    for (uint8_t i = 0U; i < LEDC_TIMERS; i++)
+    {
+        const ledc_timer_state_t& timer = timers[i];
+        if (timer.users == 0U)
+        {   continue;   }
+        printf("  Timer %u: %lu Hz, %u bits, %u channels%s\n", i,
+            (unsigned long)(timer.freq), timer.resolution, timer.users,
+            (timer.exclusive) ? " (own)" : "");
+    }
+}
+
+/*****************************************************************************/
+
+/* Private Functions */
+
+/**
+ * @details Lock of the channels and timers state, that are used from
+ * several tasks (i.e. main task and the buzzer esp_timer callbacks). It is
+ * a mutex instead of a critical section as the LEDC driver functions are
+ * called with it taken. Created on first use, so it is ready for any
+ * ledc_alloc() of a static object constructor.
+ */
+static SemaphoreHandle_t state_lock()
+{
+    static StaticSemaphore_t lock_buffer;
+    static SemaphoreHandle_t lock = xSemaphoreCreateMutexStatic(&lock_buffer);
+    return lock;
+}
 
-    //Fixing if all bits in resolution is set = LEDC FULL ON
-    uint32_t max_duty = (1 << channels_resolution[chan]) - 1;
+/**
+ * @details See ledc_alloc() (channels and timers state lock taken).
+ */
+static int8_t channel_alloc(int8_t chan, int8_t pin, uint32_t freq,
+    uint8_t bit_num, bool own_timer)
+{
+    chan = channel_find_free(chan);
+    if (chan < 0)
+    {   return -1;   }
+
+    uint8_t group = static_cast<uint8_t>(chan) / LEDC_GROUP_CHANNELS;
+    int8_t timer_index = timer_find(group, freq, bit_num, own_timer);
+    if (timer_index < 0)
+    {   return -1;   }
+
+    ledc_mode_t speed_mode = static_cast<ledc_mode_t>(group);
+    ledc_timer_t timer = static_cast<ledc_timer_t>(
+        timer_index % LEDC_GROUP_TIMERS);
+    ledc_timer_state_t* timer_state = &timers_state[timer_index];
+
+    // Configure the timer if it is not already running
+    if (timer_state->users == 0U)
+    {
+        ledc_timer_config_t ledc_timer = {};
+        ledc_timer.speed_mode = speed_mode;
+        ledc_timer.timer_num = timer;
+        ledc_timer.duty_resolution = static_cast<ledc_timer_bit_t>(bit_num);
+        ledc_timer.freq_hz = freq;
+        ledc_timer.clk_cfg = LEDC_DEFAULT_CLK;
+        if (ledc_timer_config(&ledc_timer) != ESP_OK)
+        {   return -1;   }
+
+        timer_state->exclusive = own_timer;
+        timer_state->resolution = bit_num;
+        timer_state->requested_freq = freq;
+        timer_state->freq = ledc_get_freq(speed_mode, timer);
+    }
+
+    // Attach the channel output to the pin (off)
+    if (pin != LEDC_NO_PIN)
+    {
+        ledc_channel_config_t ledc_channel = {};
+        ledc_channel.speed_mode = speed_mode;
+        ledc_channel.channel = static_cast<ledc_channel_t>(
+            chan % LEDC_GROUP_CHANNELS);
+        ledc_channel.timer_sel = timer;
+        ledc_channel.intr_type = LEDC_INTR_DISABLE;
+        ledc_channel.gpio_num = pin;
+        ledc_channel.duty = 0U;
+        ledc_channel.hpoint = 0;
+        if (ledc_channel_config(&ledc_channel) != ESP_OK)
+        {   return -1;   }
+    }
+
+    timer_state->users = timer_state->users + 1U;
+    channels_state[chan].used = true;
+    channels_state[chan].timer = static_cast<uint8_t>(timer_index);
+    return chan;
+}
 
-    if ((duty == max_duty) && (max_duty != 1))
-    {   duty = max_duty + 1;   }
+/**
+ * @details See ledc_change_frequency() (channels and timers state lock
+ * taken).
+ */
+static uint32_t timer_change_frequency(uint8_t chan, uint32_t freq)
+{
+    if (channels_state[chan].used == false)
+    {   return 0U;   }
+
+    uint8_t timer_index = channels_state[chan].timer;
+    ledc_timer_state_t* timer_state = &timers_state[timer_index];
+    if (timer_state->requested_freq == freq)
+    {   return timer_state->freq;   }
+    if (timer_state->users > 1U)
+    {   return 0U;   }
+
+    ledc_mode_t speed_mode = static_cast<ledc_mode_t>(
+        chan / LEDC_GROUP_CHANNELS);
+    ledc_timer_t timer = static_cast<ledc_timer_t>(
+        timer_index % LEDC_GROUP_TIMERS);
+    if (ledc_set_freq(speed_mode, timer, freq) != ESP_OK)
+    {   return 0U;   }
+
+    timer_state->requested_freq = freq;
+    timer_state->freq = ledc_get_freq(speed_mode, timer);
+    return timer_state->freq;
+}
+
+/**
+ * @details Requested channel if it is free, or first free channel.
+ */
+static int8_t channel_find_free(int8_t chan)
+{
+    if (chan != LEDC_ANY_CHANNEL)
+    {
+        if ( (chan < 0) || (chan >= LEDC_CHANNELS) ||
+             (channels_state[chan].used) )
+        {   return -1;   }
+        return chan;
+    }
+
+    for (uint8_t i = 0U; i < LEDC_CHANNELS; i++)
+    {
+        if (channels_state[i].used == false)
+        {   return static_cast<int8_t>(i);   }
+    }
+    return -1;
+}
+
+/**
+ * @details Shareable timer of the group running at the same frequency and
+ * resolution, or a free timer of the group.
+ */
+static int8_t timer_find(uint8_t group, uint32_t freq, uint8_t bit_num,
+    bool own_timer)
+{
+    uint8_t first = group * LEDC_GROUP_TIMERS;
+    int8_t free_timer = -1;
 
-    ledc_set_duty(group, channel, duty);
-    ledc_update_duty(group, channel);
+    for (uint8_t i = first; i < first + LEDC_GROUP_TIMERS; i++)
+    {
+        const ledc_timer_state_t& timer = timers_state[i];
+        if (timer.users == 0U)
+        {
+            if (free_timer < 0)
+            {   free_timer = static_cast<int8_t>(i);   }
+            continue;
+        }
+        if ( (own_timer == false) && (timer.exclusive == false) &&
+             (timer.resolution == bit_num) && (timer.requested_freq == freq) )
+        {   return static_cast<int8_t>(i);   }
+    }
+    return free_timer;
 }
 
 /*****************************************************************************/
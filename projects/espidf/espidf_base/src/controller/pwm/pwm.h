@@ -49,14 +49,46 @@
 
 /*****************************************************************************/
 
+/* Constants */
+
+// Any free LEDC channel (for ledc_alloc())
+static constexpr int8_t LEDC_ANY_CHANNEL = -1;
+
+// No output pin (for ledc_alloc(), channel timer only)
+static constexpr int8_t LEDC_NO_PIN = -1;
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief LEDC resources usage.
+ */
+struct ledc_usage_t
+{
+    uint8_t channels_used;
+    uint8_t channels_total;
+    uint8_t timers_used;
+    uint8_t timers_total;
+};
+
+/*****************************************************************************/
+
 /* Functions */
 
-uint32_t ledc_setup(uint8_t chan, uint32_t freq, uint8_t bit_num);
+int8_t ledc_alloc(int8_t chan, int8_t pin, uint32_t freq, uint8_t bit_num,
+    bool own_timer);
 
-void ledc_attach_pin(uint8_t pin, uint8_t chan);
+void ledc_free(uint8_t chan);
+
+uint32_t ledc_change_frequency(uint8_t chan, uint32_t freq);
 
 void ledc_write(uint8_t chan, uint32_t duty);
 
+ledc_usage_t ledc_get_usage();
+
+void ledc_dump();
+
 /*****************************************************************************/
 
 /* Include Guard Close */
@@ -0,0 +1,187 @@
+/**
+ * @file    area_coalescer.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Screen invalidated areas coalescer.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "area_coalescer.h"
+
+// Standard C++ Libraries
+#include <cstdio>
+#include <cstring>
+
+// Code Placement
+#include "memory/hot_path.h"
+
+/*****************************************************************************/
+
+/* In-Scope Functions */
+
+static inline uint32_t area_px(const lv_area_t& area);
+static inline void area_union(lv_area_t* result, const lv_area_t& a,
+    const lv_area_t& b);
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+/**
+ * @details The window cost is the overhead of sending an area to the panel
+ * (address window commands, transfer setup and LVGL per-area render), in
+ * pixel transfers. Two areas are merged when sending the extra pixels of
+ * their bounding box costs less than sending one more window.
+ */
+AreaCoalescer::AreaCoalescer(const uint32_t window_cost_px)
+{
+    this->window_cost_px = window_cost_px;
+    reset();
+}
+
+void AreaCoalescer::set_window_cost(const uint32_t window_cost_px)
+{
+    this->window_cost_px = window_cost_px;
+}
+
+/**
+ * @details Greedy merge of the pair of areas with the highest saving until
+ * no pair saves anything. Areas are marked as joined in the same way that
+ * LVGL does, and always merged into the highest index one, so the last area
+ * to be drawn keeps being the last one.
+ */
+uint16_t HOT_PATH AreaCoalescer::coalesce(lv_area_t* areas,
+    uint8_t* joined, const uint16_t num_areas)
+{
+    uint16_t num_out = 0U;
+
+    stats.frames = stats.frames + 1U;
+    for (uint16_t i = 0U; i < num_areas; i++)
+    {
+        if (joined[i])
+        {   continue;   }
+        stats.areas_in = stats.areas_in + 1U;
+        stats.px_in = stats.px_in + area_px(areas[i]);
+    }
+
+    while (true)
+    {
+        int64_t best_saving = -1;
+        uint16_t best_i = 0U;
+        uint16_t best_j = 0U;
+        lv_area_t merged;
+
+        for (uint16_t i = 0U; i < num_areas; i++)
+        {
+            if (joined[i])
+            {   continue;   }
+            for (uint16_t j = i + 1U; j < num_areas; j++)
+            {
+                if (joined[j])
+                {   continue;   }
+                area_union(&merged, areas[i], areas[j]);
+                int64_t saving = (int64_t)(area_px(areas[i])) +
+                    area_px(areas[j]) + window_cost_px - area_px(merged);
+                if (saving > best_saving)
+                {
+                    best_saving = saving;
+                    best_i = i;
+                    best_j = j;
+                }
+            }
+        }
+        if (best_saving < 0)
+        {   break;   }
+
+        area_union(&areas[best_j], areas[best_i], areas[best_j]);
+        joined[best_i] = 1U;
+    }
+
+    for (uint16_t i = 0U; i < num_areas; i++)
+    {
+        if (joined[i])
+        {   continue;   }
+        num_out = num_out + 1U;
+        stats.px_out = stats.px_out + area_px(areas[i]);
+    }
+    stats.areas_out = stats.areas_out + num_out;
+
+    return num_out;
+}
+
+const AreaCoalescer::stats_t& AreaCoalescer::get_stats()
+{
+    return stats;
+}
+
+void AreaCoalescer::reset()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void AreaCoalescer::dump()
+{
+    printf("\n[Area Coalescer] Frames: %lu (window cost %lu px)\n",
+        (unsigned long)(stats.frames), (unsigned long)(window_cost_px));
+    if (stats.frames == 0U)
+    {   return;   }
+
+    printf("  Areas: %lu -> %lu\n", (unsigned long)(stats.areas_in),
+        (unsigned long)(stats.areas_out));
+    printf("  Pixels: %llu -> %llu\n", (unsigned long long)(stats.px_in),
+        (unsigned long long)(stats.px_out));
+}
+
+/*****************************************************************************/
+
+/* Private Methods - Area Helpers */
+
+static inline uint32_t area_px(const lv_area_t& area)
+{
+    return ((uint32_t)(area.x2 - area.x1 + 1) *
+        (uint32_t)(area.y2 - area.y1 + 1));
+}
+
+static inline void area_union(lv_area_t* result, const lv_area_t& a,
+    const lv_area_t& b)
+{
+    result->x1 = (a.x1 < b.x1) ? a.x1 : b.x1;
+    result->y1 = (a.y1 < b.y1) ? a.y1 : b.y1;
+    result->x2 = (a.x2 > b.x2) ? a.x2 : b.x2;
+    result->y2 = (a.y2 > b.y2) ? a.y2 : b.y2;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,99 @@
+/**
+ * @file    area_coalescer.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Screen invalidated areas coalescer.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef AREA_COALESCER_H
+#define AREA_COALESCER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Graphic Libraies
+#include <lvgl.h>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+class AreaCoalescer
+{
+    public:
+
+        /**
+         * @brief Coalescing statistics.
+         */
+        struct stats_t
+        {
+            uint32_t frames;
+            uint32_t areas_in;
+            uint32_t areas_out;
+            uint64_t px_in;
+            uint64_t px_out;
+        };
+
+        AreaCoalescer(const uint32_t window_cost_px);
+
+        void set_window_cost(const uint32_t window_cost_px);
+
+        uint16_t coalesce(lv_area_t* areas, uint8_t* joined,
+            const uint16_t num_areas);
+
+        const stats_t& get_stats();
+
+        void reset();
+
+        void dump();
+
+    /******************************************************************/
+
+    private:
+
+        uint32_t window_cost_px;
+        stats_t stats;
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* AREA_COALESCER_H */
@@ -0,0 +1,421 @@
+/**
+ * @file    image_cache.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * LVGL decoded images cache (PSRAM, Bytes budget, LRU and pinned images).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "image_cache.h"
+
+// Standard C++ Libraries
+#include <cstdio>
+#include <cstring>
+
+// ESP-IDF Framework
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// Applied cache (LVGL cache manager callbacks have no context argument)
+static ImageCache* applied_cache = nullptr;
+
+/*****************************************************************************/
+
+/* In-Scope Functions */
+
+static bool src_match(const void* src_1, const void* src_2);
+static uint8_t draw_px_size(const lv_img_cf_t cf);
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+ImageCache::ImageCache(const size_t budget_bytes)
+{
+    this->budget_bytes = budget_bytes;
+    memset(entries, 0, sizeof(entries));
+    for (uint8_t i = 0U; i < MAX_PINNED; i++)
+    {   pinned[i] = nullptr;   }
+    use_count = 0U;
+    memset(&stats, 0, sizeof(stats));
+}
+
+/**
+ * @details Must be called after lv_init(), replacing the built-in LVGL
+ * image cache.
+ */
+void ImageCache::init()
+{
+    lv_img_cache_manager_t manager;
+
+    applied_cache = this;
+    lv_img_cache_manager_init(&manager);
+    manager.open_cb = open_cb;
+    manager.set_size_cb = set_size_cb;
+    manager.invalidate_src_cb = invalidate_src_cb;
+    lv_img_cache_manager_apply(&manager);
+}
+
+void ImageCache::set_budget(const size_t budget_bytes)
+{
+    this->budget_bytes = budget_bytes;
+    evict(0U);
+}
+
+/**
+ * @details Pinned images are never evicted (always visible assets), the
+ * source must be kept valid while it is pinned.
+ */
+bool ImageCache::pin(const void* src)
+{
+    uint8_t i = 0U;
+
+    while ( (i < MAX_PINNED) && (pinned[i] != nullptr) )
+    {   i = i + 1U;   }
+    if (i == MAX_PINNED)
+    {   return false;   }
+    pinned[i] = src;
+
+    for (entry_t& entry : entries)
+    {
+        if (entry.used && src_match(entry.lv_entry.dec_dsc.src, src))
+        {   entry.pinned = true;   }
+    }
+
+    return true;
+}
+
+void ImageCache::unpin(const void* src)
+{
+    for (uint8_t i = 0U; i < MAX_PINNED; i++)
+    {
+        if ( (pinned[i] != nullptr) && src_match(pinned[i], src) )
+        {   pinned[i] = nullptr;   }
+    }
+    for (entry_t& entry : entries)
+    {
+        if (entry.used && src_match(entry.lv_entry.dec_dsc.src, src))
+        {   entry.pinned = false;   }
+    }
+    evict(0U);
+}
+
+/**
+ * @details Drops the cached decoded images of the source (all of them if
+ * it is null), pinned or not, as its data has changed.
+ */
+void ImageCache::invalidate(const void* src)
+{
+    for (entry_t& entry : entries)
+    {
+        if ( entry.used && ( (src == nullptr) ||
+             src_match(entry.lv_entry.dec_dsc.src, src) ) )
+        {   close(entry);   }
+    }
+}
+
+const ImageCache::stats_t& ImageCache::get_stats()
+{
+    return stats;
+}
+
+/**
+ * @details The cached images are kept (and so the Bytes high-water mark
+ * starts from them).
+ */
+void ImageCache::reset_stats()
+{
+    stats.hits = 0U;
+    stats.misses = 0U;
+    stats.evictions = 0U;
+    stats.decode_us = 0U;
+    stats.bytes_max = stats.bytes;
+}
+
+void ImageCache::dump()
+{
+    uint8_t num_entries = 0U;
+    uint8_t num_pinned = 0U;
+
+    for (const entry_t& entry : entries)
+    {
+        if (entry.used)
+        {   num_entries = num_entries + 1U;   }
+        if (entry.used && entry.pinned)
+        {   num_pinned = num_pinned + 1U;   }
+    }
+    uint32_t lookups = stats.hits + stats.misses;
+    uint32_t hit_pct = (lookups > 0U) ? ((stats.hits * 100U) / lookups) : 0U;
+
+    printf("\n[Image Cache] Images: %u/%u (%u pinned), %lu/%lu Bytes "
+        "(max %lu)\n", (unsigned)(num_entries), (unsigned)(MAX_ENTRIES),
+        (unsigned)(num_pinned), (unsigned long)(stats.bytes),
+        (unsigned long)(budget_bytes), (unsigned long)(stats.bytes_max));
+    printf("  Hits: %lu, Misses: %lu (%lu%% hit rate), Evictions: %lu\n",
+        (unsigned long)(stats.hits), (unsigned long)(stats.misses),
+        (unsigned long)(hit_pct), (unsigned long)(stats.evictions));
+    printf("  Decode time: %lu us\n", (unsigned long)(stats.decode_us));
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+/**
+ * @details Returns the cached image, or decodes it in a free entry (the
+ * least recently used not pinned one if all of them are in use) and then
+ * evicts images until the cache fits in its budget again.
+ */
+_lv_img_cache_entry_t* ImageCache::open(const void* src,
+    const lv_color_t color, const int32_t frame_id)
+{
+    entry_t* slot = nullptr;
+    entry_t* lru = nullptr;
+
+    use_count = use_count + 1U;
+    for (entry_t& entry : entries)
+    {
+        if (entry.used == false)
+        {
+            if (slot == nullptr)
+            {   slot = &entry;   }
+            continue;
+        }
+
+        const lv_img_decoder_dsc_t& dsc = entry.lv_entry.dec_dsc;
+        if ( (dsc.color.full == color.full) && (dsc.frame_id == frame_id) &&
+             src_match(dsc.src, src) )
+        {
+            stats.hits = stats.hits + 1U;
+            entry.last_use = use_count;
+            return &entry.lv_entry;
+        }
+        if ( (entry.pinned == false) &&
+             ( (lru == nullptr) || (entry.last_use < lru->last_use) ) )
+        {   lru = &entry;   }
+    }
+    stats.misses = stats.misses + 1U;
+
+    // No free entry, evict the least recently used one
+    if (slot == nullptr)
+    {
+        if (lru == nullptr)
+        {   return nullptr;   }
+        close(*lru);
+        stats.evictions = stats.evictions + 1U;
+        slot = lru;
+    }
+
+    int64_t t0 = esp_timer_get_time();
+    lv_img_decoder_dsc_t& dsc = slot->lv_entry.dec_dsc;
+    if (lv_img_decoder_open(&dsc, src, color, frame_id) != LV_RES_OK)
+    {
+        memset(slot, 0, sizeof(entry_t));
+        return nullptr;
+    }
+
+    // Decoded image Bytes in RAM (none if the decoder gives the pixels of
+    // an image variable directly from flash)
+    if ( (dsc.img_data == nullptr) && decode_lines(*slot) )
+    {   slot->bytes = (size_t)(dsc.header.w) * dsc.header.h *
+            draw_px_size(dsc.header.cf);   }
+    else if ( (dsc.img_data != nullptr) &&
+              ( (dsc.src_type != LV_IMG_SRC_VARIABLE) || (dsc.img_data !=
+                static_cast<const lv_img_dsc_t*>(src)->data) ) )
+    {
+        slot->bytes = lv_img_buf_get_img_size(dsc.header.w, dsc.header.h,
+            dsc.header.cf);
+    }
+    stats.decode_us = stats.decode_us +
+        (uint32_t)(esp_timer_get_time() - t0);
+
+    evict(slot->bytes);
+    slot->used = true;
+    slot->pinned = is_pinned(src);
+    slot->last_use = use_count;
+    stats.bytes = stats.bytes + slot->bytes;
+    if (stats.bytes > stats.bytes_max)
+    {   stats.bytes_max = stats.bytes;   }
+
+    return &slot->lv_entry;
+}
+
+/**
+ * @details Images without decoded data (the decoder gives them line by
+ * line on each draw) are decoded once into a PSRAM buffer, in the pixel
+ * format that LVGL draws their lines with.
+ */
+bool ImageCache::decode_lines(entry_t& entry)
+{
+    lv_img_decoder_dsc_t& dsc = entry.lv_entry.dec_dsc;
+    uint8_t px_size = draw_px_size(dsc.header.cf);
+    lv_coord_t w = dsc.header.w;
+    lv_coord_t h = dsc.header.h;
+
+    if (px_size == 0U)
+    {   return false;   }
+
+    uint8_t* buffer = static_cast<uint8_t*>(heap_caps_malloc(
+        (size_t)(w) * h * px_size, MALLOC_CAP_SPIRAM));
+    if (buffer == nullptr)
+    {   return false;   }
+
+    for (lv_coord_t y = 0; y < h; y++)
+    {
+        if (lv_img_decoder_read_line(&dsc, 0, y, w,
+            buffer + ((size_t)(y) * w * px_size)) != LV_RES_OK)
+        {
+            heap_caps_free(buffer);
+            return false;
+        }
+    }
+    entry.line_buffer = buffer;
+    dsc.img_data = buffer;
+
+    return true;
+}
+
+/**
+ * @details Evicts the least recently used not pinned images until the
+ * needed Bytes fit in the budget (or there is nothing else to evict).
+ */
+void ImageCache::evict(const size_t bytes_needed)
+{
+    while (stats.bytes + bytes_needed > budget_bytes)
+    {
+        entry_t* lru = nullptr;
+        for (entry_t& entry : entries)
+        {
+            if ( entry.used && (entry.pinned == false) && (entry.bytes > 0U) &&
+                 ( (lru == nullptr) || (entry.last_use < lru->last_use) ) )
+            {   lru = &entry;   }
+        }
+        if (lru == nullptr)
+        {   return;   }
+        close(*lru);
+        stats.evictions = stats.evictions + 1U;
+    }
+}
+
+void ImageCache::close(entry_t& entry)
+{
+    lv_img_decoder_dsc_t& dsc = entry.lv_entry.dec_dsc;
+
+    stats.bytes = stats.bytes - entry.bytes;
+    if (entry.line_buffer != nullptr)
+    {
+        dsc.img_data = nullptr;
+        heap_caps_free(entry.line_buffer);
+    }
+    lv_img_decoder_close(&dsc);
+    memset(&entry, 0, sizeof(entry_t));
+}
+
+bool ImageCache::is_pinned(const void* src)
+{
+    for (uint8_t i = 0U; i < MAX_PINNED; i++)
+    {
+        if ( (pinned[i] != nullptr) && src_match(pinned[i], src) )
+        {   return true;   }
+    }
+    return false;
+}
+
+/*****************************************************************************/
+
+/* Private Methods - LVGL Image Cache Manager Callbacks */
+
+_lv_img_cache_entry_t* ImageCache::open_cb(const void* src,
+    lv_color_t color, int32_t frame_id)
+{
+    return applied_cache->open(src, color, frame_id);
+}
+
+/**
+ * @details The cache size is a budget of Bytes, not a number of entries.
+ */
+void ImageCache::set_size_cb(uint16_t new_entry_cnt)
+{
+    (void)(new_entry_cnt);
+}
+
+void ImageCache::invalidate_src_cb(const void* src)
+{
+    applied_cache->invalidate(src);
+}
+
+/*****************************************************************************/
+
+/* In-Scope Functions */
+
+/**
+ * @details Image variables are the same source if they are the same
+ * object, and files if they have the same path.
+ */
+static bool src_match(const void* src_1, const void* src_2)
+{
+    lv_img_src_t src_type = lv_img_src_get_type(src_1);
+
+    if (src_type == LV_IMG_SRC_VARIABLE)
+    {   return (src_1 == src_2);   }
+    if ( (src_type != LV_IMG_SRC_FILE) ||
+         (lv_img_src_get_type(src_2) != LV_IMG_SRC_FILE) )
+    {   return false;   }
+    return (strcmp(static_cast<const char*>(src_1),
+        static_cast<const char*>(src_2)) == 0);
+}
+
+/**
+ * @details Pixel size of the lines LVGL draws for each color format (0 for
+ * the formats that can't be drawn from a whole decoded buffer).
+ */
+static uint8_t draw_px_size(const lv_img_cf_t cf)
+{
+    if (lv_img_cf_is_chroma_keyed(cf))
+    {   return (LV_COLOR_SIZE / 8U);   }
+    if (cf == LV_IMG_CF_ALPHA_8BIT)
+    {   return 1U;   }
+    if (cf == LV_IMG_CF_RGB565A8)
+    {   return 0U;   }
+    if (lv_img_cf_has_alpha(cf))
+    {   return LV_IMG_PX_SIZE_ALPHA_BYTE;   }
+    return (LV_COLOR_SIZE / 8U);
+}
+
+/*****************************************************************************/
@@ -0,0 +1,150 @@
+/**
+ * @file    image_cache.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * LVGL decoded images cache (PSRAM, Bytes budget, LRU and pinned images).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef IMAGE_CACHE_H
+#define IMAGE_CACHE_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+// Graphic Libraies
+#include <lvgl.h>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @details Replaces the LVGL image cache manager (only one instance can be
+ * applied). Decoded images are kept open while they fit in a budget of
+ * Bytes (decoded pixels in RAM), evicting the least recently used ones that
+ * are not pinned. Images that their decoder only gives line by line are
+ * decoded once into a PSRAM buffer. Only used from the LVGL task.
+ */
+class ImageCache
+{
+    public:
+
+        static constexpr uint8_t MAX_ENTRIES = 32U;
+        static constexpr uint8_t MAX_PINNED = 8U;
+
+        /**
+         * @brief Cache statistics.
+         */
+        struct stats_t
+        {
+            uint32_t hits;
+            uint32_t misses;
+            uint32_t evictions;
+            uint32_t decode_us;
+            size_t bytes;
+            size_t bytes_max;
+        };
+
+        ImageCache(const size_t budget_bytes);
+
+        void init();
+
+        void set_budget(const size_t budget_bytes);
+
+        bool pin(const void* src);
+
+        void unpin(const void* src);
+
+        void invalidate(const void* src);
+
+        const stats_t& get_stats();
+
+        void reset_stats();
+
+        void dump();
+
+    /******************************************************************/
+
+    private:
+
+        /**
+         * @brief Cached image (LVGL cache entry first, it is what LVGL
+         * gets), its decoded Bytes and last use.
+         */
+        struct entry_t
+        {
+            _lv_img_cache_entry_t lv_entry;
+            size_t bytes;
+            uint8_t* line_buffer;
+            uint32_t last_use;
+            bool used;
+            bool pinned;
+        };
+
+        size_t budget_bytes;
+        entry_t entries[MAX_ENTRIES];
+        const void* pinned[MAX_PINNED];
+        uint32_t use_count;
+        stats_t stats;
+
+        _lv_img_cache_entry_t* open(const void* src, const lv_color_t color,
+            const int32_t frame_id);
+
+        bool decode_lines(entry_t& entry);
+
+        void evict(const size_t bytes_needed);
+
+        void close(entry_t& entry);
+
+        bool is_pinned(const void* src);
+
+        static _lv_img_cache_entry_t* open_cb(const void* src,
+            lv_color_t color, int32_t frame_id);
+
+        static void set_size_cb(uint16_t new_entry_cnt);
+
+        static void invalidate_src_cb(const void* src);
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* IMAGE_CACHE_H */
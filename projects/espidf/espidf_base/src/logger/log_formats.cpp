@@ -0,0 +1,55 @@
+/**
+ * @file    log_formats.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Project log messages formats (log records format identifiers).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "log_formats.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+const log_format_t LOG_FORMATS[LOG_NUM_FORMATS] =
+{
+    { LOG_MODULE_MAIN,  LOG_LEVEL_INFO, "Uptime: %lu seconds" },
+    { LOG_MODULE_TOUCH, LOG_LEVEL_INFO, "Touch X, Y: %lu, %lu" },
+    { LOG_MODULE_UI,    LOG_LEVEL_INFO, "Buzzer Frequency: %ld Hz" },
+    { LOG_MODULE_UI,    LOG_LEVEL_INFO, "Button beep pressed" }
+};
+
+/*****************************************************************************/
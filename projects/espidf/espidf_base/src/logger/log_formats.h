@@ -1,18 +1,18 @@
 /**
- * @file    driver_ft6236.h
+ * @file    log_formats.h
  * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
- * @date    2024-12-27
+ * @date    2026-10-16
  * @version 1.0.0
  *
  * @section DESCRIPTION
  *
- * FT6236 Touch panel I2C controller driver.
+ * Project log messages formats (log records format identifiers).
  *
  * @section LICENSE
  *
  * MIT License
  *
- * Copyright (c) 2024 Jose Miguel Rios Rubio
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
  *
  * Permission is hereby granted, free of charge, to any person obtaining a
  * copy of this software and associated documentation files (the "Software"),
@@ -37,32 +37,43 @@
 
 /* Include Guard */
 
-#ifndef DRIVER_FT6236_H
-#define DRIVER_FT6236_H
+#ifndef LOG_FORMATS_H
+#define LOG_FORMATS_H
 
 /*****************************************************************************/
 
 /* Libraries */
 
-// Standard C++ Libraries
-#include <cstdint>
+// Asynchronous Logger
+#include "logger.h"
 
 /*****************************************************************************/
 
 /* Data Types */
 
-// I2C Function Callback
-typedef bool (*i2c_read_callback_t)(const uint16_t, const uint8_t, uint8_t*);
+/**
+ * @brief Log messages format identifiers (LOG_FORMATS index).
+ */
+enum log_format_id_t
+{
+    LOG_UPTIME = 0,
+    LOG_TOUCH_POSITION,
+    LOG_BUZZER_FREQUENCY,
+    LOG_BUTTON_BEEP,
+    LOG_NUM_FORMATS
+};
 
 /*****************************************************************************/
 
-/* Functions */
+/* Constants */
 
-bool touch_panel_init(i2c_read_callback_t funtion_i2c_read_register);
-void touch_panel_get_position(int pos[2]);
+/**
+ * @brief Log messages formats.
+ */
+extern const log_format_t LOG_FORMATS[LOG_NUM_FORMATS];
 
 /*****************************************************************************/
 
 /* Include Guard Close */
 
-#endif /* DRIVER_FT6236_H */
+#endif /* LOG_FORMATS_H */
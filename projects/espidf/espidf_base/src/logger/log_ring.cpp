@@ -0,0 +1,130 @@
+/**
+ * @file    log_ring.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Lock-free multi-producer/single-consumer log records ring buffer.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "log_ring.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Ring buffer index mask
+static constexpr uint32_t INDEX_MASK = LogRing::CAPACITY - 1U;
+
+static_assert((LogRing::CAPACITY & INDEX_MASK) == 0U,
+    "LogRing capacity must be a power of 2");
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+LogRing::LogRing()
+{
+    for (uint32_t i = 0U; i < CAPACITY; i++)
+    {   slots[i].sequence.store(i, std::memory_order_relaxed);   }
+}
+
+/**
+ * @details Producer side. A slot is claimed moving the tail (it fails if
+ * another producer claimed it first, then retries with the new tail), and
+ * its sequence is published (release) after the record is stored, so the
+ * consumer never reads a half written record. Fails if the ring is full.
+ */
+bool LogRing::push(const log_record_t& record)
+{
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    slot_t* slot = nullptr;
+
+    while (1)
+    {
+        slot = &slots[t & INDEX_MASK];
+        uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+        int32_t diff = static_cast<int32_t>(sequence - t);
+
+        // Free slot, claim it
+        if (diff == 0)
+        {
+            if (tail.compare_exchange_weak(t, t + 1U,
+                std::memory_order_relaxed))
+            {   break;   }
+        }
+        // Slot not read yet, full
+        else if (diff < 0)
+        {   return false;   }
+        // Slot claimed by another producer
+        else
+        {   t = tail.load(std::memory_order_relaxed);   }
+    }
+
+    slot->record = record;
+    slot->sequence.store(t + 1U, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @details Consumer side. The slot is released for the producers (sequence
+ * of the next ring lap) after the record has been copied out. A claimed
+ * slot that is still being written stops the read.
+ */
+bool LogRing::pop(log_record_t& record)
+{
+    uint32_t h = head.load(std::memory_order_relaxed);
+    slot_t* slot = &slots[h & INDEX_MASK];
+
+    if (slot->sequence.load(std::memory_order_acquire) != (h + 1U))
+    {   return false;   }
+
+    record = slot->record;
+    slot->sequence.store(h + CAPACITY, std::memory_order_release);
+    head.store(h + 1U, std::memory_order_release);
+    return true;
+}
+
+uint16_t LogRing::get_size()
+{
+    uint32_t size = tail.load(std::memory_order_acquire) -
+        head.load(std::memory_order_acquire);
+
+    // Tail read before a concurrent pop moved the head
+    if (size > CAPACITY)
+    {   size = 0U;   }
+    return static_cast<uint16_t>(size);
+}
+
+/*****************************************************************************/
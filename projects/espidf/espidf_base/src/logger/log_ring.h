@@ -0,0 +1,124 @@
+/**
+ * @file    log_ring.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Lock-free multi-producer/single-consumer log records ring buffer.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <atomic>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Constants */
+
+/**
+ * @brief Maximum number of arguments of a log record.
+ */
+static constexpr uint8_t LOG_MAX_ARGS = 3U;
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Compact log record: format identifier and its arguments (the
+ * message is formatted later by the consumer).
+ */
+struct log_record_t
+{
+    uint32_t timestamp_ms;
+    uint8_t format_id;
+    int32_t args[LOG_MAX_ARGS];
+};
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @details Fixed capacity ring buffer where any number of producers (tasks)
+ * push and one consumer pops without locks: producers claim a slot moving
+ * the tail index (compare-and-swap), and each slot has a sequence number
+ * that tells if it is free, written or read.
+ */
+class LogRing
+{
+    public:
+
+        static constexpr uint16_t CAPACITY = 64U;
+
+        LogRing();
+
+        bool push(const log_record_t& record);
+
+        bool pop(log_record_t& record);
+
+        uint16_t get_size();
+
+    /******************************************************************/
+
+    private:
+
+        /**
+         * @brief Ring slot, its sequence is the tail index value that can
+         * write it (free) or that value + 1 (written, can be read).
+         */
+        struct slot_t
+        {
+            std::atomic<uint32_t> sequence;
+            log_record_t record;
+        };
+
+        // Free running indexes (the capacity divides their range)
+        std::atomic<uint32_t> tail{0U};
+        std::atomic<uint32_t> head{0U};
+
+        slot_t slots[CAPACITY];
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* LOG_RING_H */
@@ -0,0 +1,254 @@
+/**
+ * @file    logger.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Asynchronous logger (compact records queued on the hot path, formatted and output by a low priority task).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "logger.h"
+
+// Standard C++ Libraries
+#include <cstdio>
+
+// ESP-IDF Framework
+#include "esp_timer.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Log modules names (dump)
+static const char* MODULE_NAMES[LOG_NUM_MODULES] =
+{
+    "main",
+    "touch",
+    "ui"
+};
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+AsyncLogger::AsyncLogger(const log_format_t* formats,
+    const uint8_t num_formats, const log_level_t level)
+{
+    this->formats = formats;
+    this->num_formats = num_formats;
+    for (uint8_t i = 0U; i < LOG_NUM_MODULES; i++)
+    {   levels[i].store(level, std::memory_order_relaxed);   }
+    task_handle = nullptr;
+    dropped_reported = 0U;
+}
+
+/**
+ * @details If the logger task can't be launched, records are output
+ * directly in the logging task context.
+ */
+bool AsyncLogger::init(const int core, const uint32_t stack_size,
+    const uint32_t priority)
+{
+    if (xTaskCreatePinnedToCore(task_logger, "task_log", stack_size,
+        this, priority, &task_handle, core) != pdPASS)
+    {
+        task_handle = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @details Hot path: no formatting nor output, just the level filter and a
+ * record copy to the ring (dropped and counted if the ring is full).
+ */
+bool AsyncLogger::log(const uint8_t format_id, const int32_t arg0,
+    const int32_t arg1, const int32_t arg2)
+{
+    if (is_enabled(format_id) == false)
+    {
+        filtered.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+    }
+
+    log_record_t record;
+    record.timestamp_ms = (uint32_t)(esp_timer_get_time() / 1000LL);
+    record.format_id = format_id;
+    record.args[0] = arg0;
+    record.args[1] = arg1;
+    record.args[2] = arg2;
+    if (ring.push(record) == false)
+    {
+        dropped.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+    }
+    written.fetch_add(1U, std::memory_order_relaxed);
+
+    uint32_t size = ring.get_size();
+    uint32_t size_max = ring_max.load(std::memory_order_relaxed);
+    while (size > size_max)
+    {
+        if (ring_max.compare_exchange_weak(size_max, size,
+            std::memory_order_relaxed))
+        {   break;   }
+    }
+
+    // No logger task, output it now
+    if (task_handle == nullptr)
+    {   process();   }
+    else
+    {   xTaskNotifyGive(task_handle);   }
+
+    return true;
+}
+
+/**
+ * @details Consumer side (logger task), outputs all the queued records and
+ * the number of records dropped since the last call. Without logger task
+ * it is called from any logging task, so only one of them consumes at a
+ * time (the others leave their records to it).
+ */
+void AsyncLogger::process()
+{
+    log_record_t record;
+
+    if (consuming.exchange(true, std::memory_order_acquire))
+    {   return;   }
+
+    while (ring.pop(record))
+    {   output(record);   }
+
+    // Counters reset since the last report, just resync
+    uint32_t num_dropped = dropped.load(std::memory_order_relaxed);
+    if (num_dropped > dropped_reported)
+    {
+        printf("[LOG] %lu records dropped\n",
+            (unsigned long)(num_dropped - dropped_reported));
+    }
+    dropped_reported = num_dropped;
+
+    consuming.store(false, std::memory_order_release);
+}
+
+bool AsyncLogger::is_enabled(const uint8_t format_id)
+{
+    if (format_id >= num_formats)
+    {   return false;   }
+
+    const log_format_t& format = formats[format_id];
+    return (format.level <= levels[format.module].load(
+        std::memory_order_relaxed));
+}
+
+void AsyncLogger::set_level(const log_module_t module,
+    const log_level_t level)
+{
+    if (module >= LOG_NUM_MODULES)
+    {   return;   }
+    levels[module].store(level, std::memory_order_relaxed);
+}
+
+log_level_t AsyncLogger::get_level(const log_module_t module)
+{
+    if (module >= LOG_NUM_MODULES)
+    {   return LOG_LEVEL_NONE;   }
+    return static_cast<log_level_t>(levels[module].load(
+        std::memory_order_relaxed));
+}
+
+AsyncLogger::stats_t AsyncLogger::get_stats()
+{
+    stats_t stats;
+
+    stats.written = written.load(std::memory_order_relaxed);
+    stats.dropped = dropped.load(std::memory_order_relaxed);
+    stats.filtered = filtered.load(std::memory_order_relaxed);
+    stats.ring_max = ring_max.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void AsyncLogger::reset_stats()
+{
+    written.store(0U, std::memory_order_relaxed);
+    dropped.store(0U, std::memory_order_relaxed);
+    filtered.store(0U, std::memory_order_relaxed);
+    ring_max.store(0U, std::memory_order_relaxed);
+}
+
+void AsyncLogger::dump()
+{
+    stats_t stats = get_stats();
+
+    printf("\n[Logger] Records: %lu written, %lu dropped, %lu filtered, "
+        "ring max %lu/%u\n", (unsigned long)(stats.written),
+        (unsigned long)(stats.dropped), (unsigned long)(stats.filtered),
+        (unsigned long)(stats.ring_max), (unsigned)(LogRing::CAPACITY));
+    printf("  Levels:");
+    for (uint8_t i = 0U; i < LOG_NUM_MODULES; i++)
+    {
+        printf(" %s %u", MODULE_NAMES[i],
+            (unsigned)(levels[i].load(std::memory_order_relaxed)));
+    }
+    printf("\n");
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+void AsyncLogger::output(const log_record_t& record)
+{
+    printf("(%lu) ", (unsigned long)(record.timestamp_ms));
+    printf(formats[record.format_id].format, (long)(record.args[0]),
+        (long)(record.args[1]), (long)(record.args[2]));
+    printf("\n");
+}
+
+/**
+ * @details The logger task is notified for each queued record, and outputs
+ * all the queued ones on each wake-up.
+ */
+void AsyncLogger::task_logger(void* arg)
+{
+    AsyncLogger* logger = static_cast<AsyncLogger*>(arg);
+
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        logger->process();
+    }
+}
+
+/*****************************************************************************/
@@ -0,0 +1,165 @@
+/**
+ * @file    logger.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Asynchronous logger (compact records queued on the hot path, formatted and output by a low priority task).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <atomic>
+#include <cstdint>
+
+// FreeRTOS Library
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Log Records Ring Buffer
+#include "log_ring.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Log levels (a module logs the messages up to its level).
+ */
+enum log_level_t
+{
+    LOG_LEVEL_NONE = 0,
+    LOG_LEVEL_ERROR,
+    LOG_LEVEL_WARN,
+    LOG_LEVEL_INFO,
+    LOG_LEVEL_DEBUG
+};
+
+/**
+ * @brief Log modules (each one with its own runtime log level).
+ */
+enum log_module_t
+{
+    LOG_MODULE_MAIN = 0,
+    LOG_MODULE_TOUCH,
+    LOG_MODULE_UI,
+    LOG_NUM_MODULES
+};
+
+/**
+ * @brief Log message format (printf format of up to LOG_MAX_ARGS long
+ * integer arguments, "%ld" or "%lu", without the ending new line).
+ */
+struct log_format_t
+{
+    log_module_t module;
+    log_level_t level;
+    const char* format;
+};
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+class AsyncLogger
+{
+    public:
+
+        /**
+         * @brief Logger statistics.
+         */
+        struct stats_t
+        {
+            uint32_t written;
+            uint32_t dropped;
+            uint32_t filtered;
+            uint32_t ring_max;
+        };
+
+        AsyncLogger(const log_format_t* formats, const uint8_t num_formats,
+            const log_level_t level);
+
+        bool init(const int core, const uint32_t stack_size,
+            const uint32_t priority);
+
+        bool log(const uint8_t format_id, const int32_t arg0 = 0,
+            const int32_t arg1 = 0, const int32_t arg2 = 0);
+
+        void process();
+
+        bool is_enabled(const uint8_t format_id);
+
+        void set_level(const log_module_t module, const log_level_t level);
+
+        log_level_t get_level(const log_module_t module);
+
+        stats_t get_stats();
+
+        void reset_stats();
+
+        void dump();
+
+    /******************************************************************/
+
+    private:
+
+        const log_format_t* formats;
+        uint8_t num_formats;
+        std::atomic<uint8_t> levels[LOG_NUM_MODULES];
+
+        LogRing ring;
+        TaskHandle_t task_handle;
+
+        std::atomic<uint32_t> written{0U};
+        std::atomic<uint32_t> dropped{0U};
+        std::atomic<uint32_t> filtered{0U};
+        std::atomic<uint32_t> ring_max{0U};
+        uint32_t dropped_reported;
+        std::atomic<bool> consuming{false};
+
+        void output(const log_record_t& record);
+
+        static void task_logger(void* arg);
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* LOGGER_H */
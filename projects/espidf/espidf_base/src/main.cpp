@@ -39,20 +39,27 @@
 
 // Standard C++ Libararies
 #include <stdio.h>
+#include <string.h>
 
 // FreeRTOS Libraries
 #include "sdkconfig.h"
 #include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
 #include "freertos/task.h"
 
 // ESP-IDF Framework
 #include "driver/gpio.h"
 #include "controller/i2c/i2c.h"
+#include "controller/i2c/i2c_scheduler.h"
+#include "controller/pwm/pwm.h"
 #include "esp_heap_caps.h"
+#include "esp_intr_alloc.h"
 #include "esp_log.h"
 #include "esp_psram.h"
 #include "esp_system.h"
 #include "esp_timer.h"
+#include "hal/lcd_ll.h"
+#include "soc/interrupts.h"
 
 // Graphic Libraies
 #include <lvgl.h>
@@ -61,7 +68,75 @@
 #include "config/config.h"
 #include "config/config_screen.h"
 #include "buzzer/driver_passive_buzzer.h"
+#include "display/area_coalescer.h"
+#include "display/image_cache.h"
+#include "logger/logger.h"
+#include "logger/log_formats.h"
+#include "memory/hot_path.h"
+#include "memory/tiered_allocator.h"
+#include "profiler/boot_profiler.h"
+#include "profiler/frame_profiler.h"
 #include "touch_panel/driver_ft6236.h"
+#include "touch_panel/touch_i2c.h"
+#include "ui/ui_binder.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// UI Update Message Identifiers
+enum ui_msg_id_t
+{
+    UI_MSG_UPTIME = 0,
+    UI_MSG_PROFILER_DUMP,
+    UI_MSG_PROFILER_RESET,
+    UI_MSG_DISPLAY_BUFFER_STRATEGY,
+    UI_MSG_DISPLAY_BENCHMARK,
+    UI_MSG_BUZZER_BEEP,
+    UI_MSG_BUZZER_MELODY
+};
+
+// UI Bound Values Identifiers (labels subscribed to them)
+enum ui_value_id_t
+{
+    UI_VALUE_UPTIME = 0,
+    UI_VALUE_BUZZER_FREQ,
+    UI_VALUE_TOUCH_POSITION
+};
+
+// Buzzer Melodies Identifiers (UI_MSG_BUZZER_MELODY value)
+enum ui_melody_id_t
+{
+    UI_MELODY_ALARM = 0,
+    UI_MELODY_STARTUP,
+    UI_MELODY_NUM_MELODIES
+};
+
+// UI Update Message (from any task to the UI task)
+struct ui_msg_t
+{
+    ui_msg_id_t id;
+    uint32_t value;
+};
+
+// Screen Render Buffers Strategy Configuration
+struct screen_buffer_config_t
+{
+    const char* name;
+    uint8_t num_buffers;
+    uint32_t buffer_size;
+    uint32_t heap_caps;
+    bool flush_dma;
+};
+
+// Touch Panel Sample (from the touch reading task to the UI task)
+struct touch_sample_t
+{
+    uint32_t timestamp_ms;
+    bool pressed;
+    uint16_t x;
+    uint16_t y;
+};
 
 /*****************************************************************************/
 
@@ -71,27 +146,79 @@
 extern "C" { void app_main(void); }
 
 // Initialization
+bool rtos_init();
 bool buzzer_init();
 void touch_init();
+bool touch_int_init();
+void boot_peripherals_init();
 void screen_init();
+bool screen_backlight_set(const bool on);
 void display_init();
 
+// Tasks
+void task_ui(void* arg);
+void task_boot(void* arg);
+void task_touch(void* arg);
+bool touch_task_wait_read(const bool pressed);
+
+// Interrupt Handlers
+void isr_touch_int(void* arg);
+void isr_display_dma_done(void* arg);
+
 // Management
-void manage_uptime();
-void manage_buzzer();
-void manage_ui();
+uint32_t manage_uptime();
+uint32_t manage_touch();
+bool touch_read_sample();
+void manage_console();
+uint32_t manage_ui();
+
+// Thread-Safe Interface
+bool ui_post(const ui_msg_id_t id, const uint32_t value);
+bool ui_post_from_isr(const ui_msg_id_t id, const uint32_t value);
+void ui_wake();
+void ui_process_msg(const ui_msg_t& msg);
+bool buzzer_request_beep(const uint16_t frequency, const uint16_t time_ms);
+bool buzzer_request_beep_from_isr(const uint16_t frequency,
+    const uint16_t time_ms);
+bool buzzer_startup_melody();
 
 // LVGL Callbacks
 void display_refresh(lv_disp_drv_t* disp_drv, const lv_area_t* area,
     lv_color_t* color_p);
+void display_flush_wait(lv_disp_drv_t* disp_drv);
+void display_render_start(lv_disp_drv_t* disp_drv);
 void display_manage_touch(lv_indev_drv_t* indev_driver, lv_indev_data_t* data);
+void display_refr_timer(lv_timer_t* timer);
+
+// Display Flush
+void display_flush_complete();
+void display_flush_wait_all();
+void display_frame_sent(lv_disp_drv_t* disp_drv);
+bool display_dma_irq_init();
+
+// Display Render Buffers
+bool display_set_buffer_strategy(const screen_buffer_strategy_t strategy);
+bool display_buffers_alloc(const screen_buffer_strategy_t strategy,
+    lv_color_t** new_buf_1, lv_color_t** new_buf_2);
+void display_buffers_set(const screen_buffer_strategy_t strategy,
+    lv_color_t* new_buf_1, lv_color_t* new_buf_2);
+const char* display_buffer_strategy_name(
+    const screen_buffer_strategy_t strategy);
+void display_benchmark();
+
+// PWM
+void pwm_benchmark();
 
 // UI Draw
 void ui_draw_screen_1();
 
+// Tasks Wake-ups
+void tasks_wakeups_dump();
+void tasks_wakeups_reset();
+
 // Auxiliary Functions
-bool touch_i2c_read_register(const uint16_t slave_address,
-    const uint8_t reg_address, uint8_t* data_read);
+bool touch_i2c_probe_read(const uint32_t frequency);
+TickType_t ms_to_ticks_ceil(const uint32_t ms);
 
 /*****************************************************************************/
 
@@ -104,13 +231,85 @@ PassiveBuzzer Buzzer(IO_BUZZER, 0U, ns_const::BUZZER_MIN_FREQ_HZ,
 // Screen Device
 LGFX Screen;
 
-// UI Render Buffer
+// Render Pipeline Profiler
+FrameProfiler Profiler;
+
+// Boot Phases Profiler
+BootProfiler Boot;
+
+// Asynchronous Logger
+AsyncLogger Log(LOG_FORMATS, LOG_NUM_FORMATS, LOG_LEVEL_INFO);
+
+// LVGL Tiered Allocator (memory/lv_allocator.cpp)
+extern TieredAllocator LvglAllocator;
+
+// I2C Bus Scheduler (Touch Panel and I2C sensors)
+I2CScheduler I2CBus(I2C_PORT_TOUCH);
+
+// Screen Invalidated Areas Coalescer
+AreaCoalescer Coalescer(ns_const::SCREEN_AREA_WINDOW_COST_PX);
+
+// LVGL Decoded Images Cache
+ImageCache ImgCache(ns_const::SCREEN_IMG_CACHE_BUDGET_BYTES);
+
+// Inter-Task Queues
+QueueHandle_t ui_queue = nullptr;
+QueueHandle_t touch_queue = nullptr;
+
+// Touch Task (interrupt mode)
+TaskHandle_t touch_task_handle = nullptr;
+
+// UI Task (woken up by UI events) and Touch Panel LVGL Input Device
+TaskHandle_t ui_task_handle = nullptr;
+lv_indev_t* touch_indev = nullptr;
+
+// Tasks Wake-ups (since last profiler reset)
+uint32_t ui_task_wakeups = 0U;
+uint32_t main_task_wakeups = 0U;
+int64_t t_wakeups_reset = 0;
+
+// Buzzer Melodies (ui_melody_id_t order)
+static const melody_t* const UI_MELODIES[UI_MELODY_NUM_MELODIES] =
+{
+    &MELODY_ALARM,
+    &MELODY_STARTUP
+};
+
+// UI Render Buffers Strategies
+static const screen_buffer_config_t SCREEN_BUFFER_CONFIGS[] =
+{
+    // SCREEN_BUFFER_INTERNAL_SINGLE
+    { "internal_single", 1U, (ns_const::SCREEN_WIDTH *
+        ns_const::SCREEN_HEIGHT / 5U), MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA,
+        false },
+
+    // SCREEN_BUFFER_INTERNAL_DOUBLE
+    { "internal_double", 2U, (ns_const::SCREEN_WIDTH *
+        ns_const::SCREEN_HEIGHT / 10U), MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA,
+        true },
+
+    // SCREEN_BUFFER_PSRAM_FULL (CPU copy, no DMA from PSRAM)
+    { "psram_full", 1U, (ns_const::SCREEN_WIDTH * ns_const::SCREEN_HEIGHT),
+        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT, false },
+};
+
+// UI Render Buffers
 lv_disp_draw_buf_t draw_buf;
-lv_color_t buf[ns_const::SCREEN_BUFFER_SIZE];
+lv_color_t* buf_1 = nullptr;
+lv_color_t* buf_2 = nullptr;
+screen_buffer_strategy_t buffer_strategy = ns_const::SCREEN_BUFFER_STRATEGY;
+
+// Display Driver with a DMA flush transfer in progress, the transfer
+// launch time and its pixels
+lv_disp_drv_t* flush_pending_drv = nullptr;
+int64_t flush_pending_t0 = 0;
+uint32_t flush_pending_px = 0U;
 
-// UI Draw Texts buffer
-static const uint32_t MAX_TEXT_LENGTH = 1024U;
-char text[MAX_TEXT_LENGTH];
+// First frame not sent to the screen yet
+bool display_first_frame_pending = true;
+
+// UI Values Data-Binding
+UIBinder Binder;
 
 // UI Elements
 lv_obj_t* ui_info_box = nullptr;
@@ -120,9 +319,12 @@ lv_obj_t* ui_slider_buzzer_freq = nullptr;
 lv_obj_t* ui_label_buzzer_freq = nullptr;
 lv_obj_t* ui_label_touch = nullptr;
 
-// Touch Panel
-uint16_t touch_x = 0U;
-uint16_t touch_y = 0U;
+// Touch Panel (I2C transport resolved at compile time)
+FT6236<TouchI2C> TouchPanel;
+
+// Touch Panel Identification (to verify the reads of the I2C frequency
+// probe)
+uint8_t touch_id[TOUCH_PANEL_ID_LENGTH];
 
 // Buzzer Frequency
 uint16_t buzzer_freq = ns_const::BUZZER_MIN_FREQ_HZ;
@@ -135,6 +337,7 @@ void app_main(void)
 {
     using namespace ns_const;
 
+    Boot.mark("app_main");
     printf("\n\n---------\n\n");
     printf("Project: %s\n", PROJECT_NAME);
     printf("FW Version: v%u.%u.%u (%s %s)\n", FW_APP_VERSION_X,
@@ -144,30 +347,205 @@ void app_main(void)
     printf("\n");
 
     // Initializations
+    uint8_t boot_phase = Boot.begin("rtos");
+    rtos_init();
+    if (Log.init(LOG_TASK_CORE, LOG_TASK_STACK_SIZE, LOG_TASK_PRIORITY))
+    {   printf("[OK] Logger Task launched on core %d\n", LOG_TASK_CORE);   }
+    else
+    {   printf("[FAIL] Logger Task launch\n");   }
+    Boot.end(boot_phase);
+    boot_phase = Boot.begin("i2c");
     i2c_setup(I2C_PORT_TOUCH, IO_I2C_SDA, IO_I2C_SCL, I2C_FREQUENCY_HZ);
-    buzzer_init();
-    touch_init();
+    if (I2CBus.init(I2C_QUEUE_SIZE, I2C_TASK_CORE, I2C_TASK_STACK_SIZE,
+        I2C_TASK_PRIORITY))
+    {
+        printf("[OK] I2C Scheduler Task launched on core %d\n",
+            I2C_TASK_CORE);
+    }
+    else
+    {   printf("[FAIL] I2C Scheduler Task launch\n");   }
+    Boot.end(boot_phase);
+
+    // Buzzer and Touch Panel (I2C frequency probe) don't depend on the
+    // display, on fast boot they are initialized by the Boot Task while the
+    // screen and LVGL are set up
+    TaskHandle_t boot_task_handle = nullptr;
+    if ( FAST_BOOT && (xTaskCreatePinnedToCore(task_boot, "task_boot",
+         BOOT_TASK_STACK_SIZE, xTaskGetCurrentTaskHandle(),
+         BOOT_TASK_PRIORITY, &boot_task_handle, BOOT_TASK_CORE) == pdPASS) )
+    {   printf("[OK] Boot Task launched on core %d\n", BOOT_TASK_CORE);   }
+    else
+    {   boot_peripherals_init();   }
+    boot_phase = Boot.begin("screen");
     screen_init();
+    Boot.end(boot_phase);
+    boot_phase = Boot.begin("lvgl");
     display_init();
+    Boot.end(boot_phase);
+    printf("\n");
+    printf("Console commands: 'p' profiler dump; 'r' profiler reset; "
+        "'b' screen buffers benchmark; '1'..'%d' screen buffers strategy; "
+        "'i' I2C scheduler stats; 'm' buzzer alarm melody; "
+        "'f' PWM frequency change benchmark; 'l' touch logs on/off\n",
+        (int)(SCREEN_BUFFER_NUM_STRATEGIES));
     printf("\n");
 
     // Draw First Screen
+    boot_phase = Boot.begin("ui_draw");
     ui_draw_screen_1();
+    Boot.end(boot_phase);
 
-    // Main Loop
+    // Fast boot, render and send the first frame right away (the backlight
+    // is turned on when it is sent, see display_frame_sent())
+    if (FAST_BOOT)
+    {
+        boot_phase = Boot.begin("first_render");
+        lv_refr_now(NULL);
+        display_flush_wait_all();
+        Boot.end(boot_phase);
+    }
+
+    // Wait for the Boot Task initializations
+    if (boot_task_handle != nullptr)
+    {
+        boot_phase = Boot.begin("boot_task_wait");
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        Boot.end(boot_phase);
+    }
+
+    // Launch UI Task (LVGL render) in its own CPU Core, from now on the UI
+    // must only be modified from it (use the Thread-Safe Interface)
+    if (xTaskCreatePinnedToCore(task_ui, "task_ui", UI_TASK_STACK_SIZE,
+        NULL, UI_TASK_PRIORITY, &ui_task_handle, UI_TASK_CORE) == pdPASS)
+    {   printf("[OK] UI Task launched on core %d\n", UI_TASK_CORE);   }
+    else
+    {   printf("[FAIL] UI Task launch\n");   }
+    Boot.mark("ui_task");
+    Boot.dump();
+    buzzer_startup_melody();
+
+    // Main Loop (peripherals management), sleeps until the next management
+    // work is due (or a task notification wakes it up)
     while(1)
     {
-        manage_uptime();
-        manage_buzzer();
-        manage_ui();
-        vTaskDelay(10U/portTICK_PERIOD_MS);
+        uint32_t sleep_ms = MAIN_LOOP_MAX_SLEEP_MS;
+        uint32_t due_ms = manage_uptime();
+        if (due_ms < sleep_ms)
+        {   sleep_ms = due_ms;   }
+        due_ms = manage_touch();
+        if (due_ms < sleep_ms)
+        {   sleep_ms = due_ms;   }
+        manage_console();
+        ulTaskNotifyTake(pdTRUE, ms_to_ticks_ceil(sleep_ms));
+        main_task_wakeups = main_task_wakeups + 1U;
     }
 }
 
 /*****************************************************************************/
 
+/* Tasks */
+
+void task_ui(void* arg)
+{
+    while(1)
+    {
+        // Sleep until the next LVGL timer is due or an UI event (message,
+        // touch sample or DMA flush transfer end) wakes the task up
+        uint32_t sleep_ms = manage_ui();
+        ulTaskNotifyTake(pdTRUE, ms_to_ticks_ceil(sleep_ms));
+        ui_task_wakeups = ui_task_wakeups + 1U;
+    }
+}
+
+/**
+ * @details Fast boot parallel initializations, notifies the task that
+ * launched it (arg) when they are done.
+ */
+void task_boot(void* arg)
+{
+    boot_peripherals_init();
+    xTaskNotifyGive(static_cast<TaskHandle_t>(arg));
+    vTaskDelete(NULL);
+}
+
+#if (IO_TOUCH_INT >= 0)
+void task_touch(void* arg)
+{
+    bool pressed = false;
+
+    while(1)
+    {   pressed = touch_task_wait_read(pressed);   }
+}
+
+/**
+ * @details Waits for a Touch Panel interrupt (no I2C traffic while idle),
+ * while pressed re-reads on timeout in case a lift up is missed. Returns if
+ * the panel is pressed.
+ */
+bool touch_task_wait_read(const bool pressed)
+{
+    TickType_t timeout = portMAX_DELAY;
+
+    if (pressed)
+    {   timeout = pdMS_TO_TICKS(ns_const::TOUCH_PRESSED_TIMEOUT_MS);   }
+    if ( (ulTaskNotifyTake(pdTRUE, timeout) == 0U) && (pressed == false) )
+    {   return false;   }
+
+    return touch_read_sample();
+}
+
+/*****************************************************************************/
+
+/* Interrupt Handlers */
+
+void IRAM_ATTR isr_touch_int(void* arg)
+{
+    BaseType_t higher_priority_task_woken = pdFALSE;
+
+    vTaskNotifyGiveFromISR(touch_task_handle, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+#endif
+
+/**
+ * @details LCD_CAM transaction done (a DMA flush transfer ended), wakes the
+ * UI task up to release the render buffer to LVGL. The interrupt is shared,
+ * only its transfer done event is handled.
+ */
+void IRAM_ATTR isr_display_dma_done(void* arg)
+{
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    uint32_t status = lcd_ll_get_interrupt_status(&LCD_CAM);
+
+    if ((status & LCD_LL_EVENT_TRANS_DONE) == 0U)
+    {   return;   }
+    lcd_ll_clear_interrupt_status(&LCD_CAM, LCD_LL_EVENT_TRANS_DONE);
+    if (ui_task_handle != nullptr)
+    {   vTaskNotifyGiveFromISR(ui_task_handle, &higher_priority_task_woken);   }
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+
+/*****************************************************************************/
+
 /* Initialization Functions */
 
+bool rtos_init()
+{
+    using namespace ns_const;
+
+    ui_queue = xQueueCreate(UI_QUEUE_SIZE, sizeof(ui_msg_t));
+    touch_queue = xQueueCreate(TOUCH_QUEUE_SIZE, sizeof(touch_sample_t));
+
+    if ( (ui_queue == nullptr) || (touch_queue == nullptr) )
+    {
+        printf("[FAIL] RTOS init\n");
+        return false;
+    }
+
+    printf("[OK] RTOS init\n");
+    return true;
+}
+
 bool buzzer_init()
 {
     bool init_ok = true;
@@ -188,27 +566,103 @@ bool buzzer_init()
     {   init_ok = false;   }
 printf("Buzzer init\n");
     Buzzer.init();
-    printf("Buzzer Beep\n");
-    Buzzer.beep(ns_const::BUZZER_MAX_FREQ_HZ, 100U);
+    if (ns_const::BUZZER_STARTUP_MELODY == false)
+    {
+        printf("Buzzer Beep\n");
+        Buzzer.beep(ns_const::BUZZER_MAX_FREQ_HZ, 100U);
+    }
 
     return init_ok;
 }
 
 void touch_init()
 {
-    if (touch_panel_init(touch_i2c_read_register))
-    {   printf("[OK] Touch init\n");   }
+    // Touch Panel transactions go through the I2C Bus Scheduler
+    TouchI2C::attach(&I2CBus);
+
+    // Read Touch Panel ID and probe fastest I2C frequency where its reads
+    // are right
+    if (TouchPanel.read_id(touch_id))
+    {
+        printf("[OK] Touch init\n");
+        TouchI2C::set_frequency(i2c_probe_frequency(I2C_PORT_TOUCH,
+            ns_const::TOUCH_I2C_FREQUENCIES_HZ,
+            sizeof(ns_const::TOUCH_I2C_FREQUENCIES_HZ) /
+            sizeof(ns_const::TOUCH_I2C_FREQUENCIES_HZ[0]),
+            touch_i2c_probe_read));
+        printf("[OK] Touch I2C frequency: %lu Hz\n",
+            (unsigned long)(TouchI2C::get_frequency()));
+    }
     else
     {   printf("[FAIL] Touch init\n");   }
+
+#if (IO_TOUCH_INT >= 0)
+    if (touch_int_init())
+    {   printf("[OK] Touch interrupt init\n");   }
+    else
+    {   printf("[FAIL] Touch interrupt init\n");   }
+#endif
 }
 
+#if (IO_TOUCH_INT >= 0)
+bool touch_int_init()
+{
+    using namespace ns_const;
+
+    // Make the FT6236 pulse INT pin on each new touch report
+    if (TouchPanel.set_int_trigger_mode() == false)
+    {   return false;   }
+
+    // Setup IO_TOUCH_INT pin as Digital Input with falling edge interrupt
+    gpio_num_t io_touch_int = static_cast<gpio_num_t>(IO_TOUCH_INT);
+    gpio_config_t io_conf = {};
+    io_conf.intr_type = GPIO_INTR_NEGEDGE;
+    io_conf.mode = GPIO_MODE_INPUT;
+    io_conf.pin_bit_mask = (1ULL << io_touch_int);
+    io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
+    io_conf.pull_up_en = GPIO_PULLUP_ENABLE;
+    if (gpio_config(&io_conf) != ESP_OK)
+    {   return false;   }
+
+    // Launch Touch Task, it will be woken up by the interrupt
+    if (xTaskCreatePinnedToCore(task_touch, "task_touch",
+        TOUCH_TASK_STACK_SIZE, NULL, TOUCH_TASK_PRIORITY,
+        &touch_task_handle, TOUCH_TASK_CORE) != pdPASS)
+    {   return false;   }
+
+    // Attach Interrupt Handler
+    esp_err_t ret = gpio_install_isr_service(0);
+    if ( (ret != ESP_OK) && (ret != ESP_ERR_INVALID_STATE) )
+    {   return false;   }
+    if (gpio_isr_handler_add(io_touch_int, isr_touch_int, NULL) != ESP_OK)
+    {   return false;   }
+
+    return true;
+}
+#endif
+
+void boot_peripherals_init()
+{
+    uint8_t boot_phase = Boot.begin("buzzer");
+    buzzer_init();
+    Boot.end(boot_phase);
+    boot_phase = Boot.begin("touch");
+    touch_init();
+    Boot.end(boot_phase);
+}
+
+/**
+ * @details On fast boot the screen is not cleared: the backlight stays off
+ * until the first frame (that covers the whole screen) is sent.
+ */
 void screen_init()
 {
     bool init_ok = true;
 
     Screen.begin();
     Screen.setRotation(1U);
-    Screen.fillScreen(TFT_BLACK);
+    if (ns_const::FAST_BOOT == false)
+    {   Screen.fillScreen(TFT_BLACK);   }
 
     gpio_num_t io_lcd_backlight = static_cast<gpio_num_t>(IO_LCD_BACKLIGHT);
     gpio_config_t io_conf = {};
@@ -219,7 +673,7 @@ void screen_init()
     io_conf.pull_up_en = GPIO_PULLUP_DISABLE;
     if (gpio_config(&io_conf) != ESP_OK)
     {   init_ok = false;   }
-    if (gpio_set_level(io_lcd_backlight, 1U) != ESP_OK)
+    if (screen_backlight_set(ns_const::FAST_BOOT == false) == false)
     {   init_ok = false;   }
 
     if (init_ok)
@@ -228,10 +682,25 @@ void screen_init()
     {   printf("[FAIL] Screen init\n");   }
 }
 
+bool screen_backlight_set(const bool on)
+{
+    gpio_num_t io_lcd_backlight = static_cast<gpio_num_t>(IO_LCD_BACKLIGHT);
+
+    return (gpio_set_level(io_lcd_backlight, (on) ? 1U : 0U) == ESP_OK);
+}
+
 void display_init()
 {
+    if (LvglAllocator.init() == false)
+    {   printf("[FAIL] LVGL slab pools, using the heap\n");   }
     lv_init();
-    lv_disp_draw_buf_init(&draw_buf, buf, NULL, ns_const::SCREEN_BUFFER_SIZE);
+    ImgCache.init();
+    if (display_set_buffer_strategy(ns_const::SCREEN_BUFFER_STRATEGY) == false)
+    {
+        printf("[FAIL] Screen buffers %s, fallback to %s\n",
+            display_buffer_strategy_name(ns_const::SCREEN_BUFFER_STRATEGY),
+            display_buffer_strategy_name(buffer_strategy));
+    }
 
     // Setup Display
     static lv_disp_drv_t disp_drv;
@@ -239,8 +708,13 @@ void display_init()
     disp_drv.hor_res = ns_const::SCREEN_WIDTH;
     disp_drv.ver_res = ns_const::SCREEN_HEIGHT;
     disp_drv.flush_cb = display_refresh;
+    disp_drv.wait_cb = display_flush_wait;
+    disp_drv.render_start_cb = display_render_start;
     disp_drv.draw_buf = &draw_buf;
-    lv_disp_drv_register(&disp_drv);
+    lv_disp_t* disp = lv_disp_drv_register(&disp_drv);
+
+    // Bound UI values are applied by the display refresh timer
+    lv_timer_set_cb(disp->refr_timer, display_refr_timer);
 
     // Setup Background
     lv_obj_t* screen = lv_scr_act();
@@ -252,7 +726,11 @@ void display_init()
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = display_manage_touch;
-    lv_indev_drv_register(&indev_drv);
+    touch_indev = lv_indev_drv_register(&indev_drv);
+
+    // DMA flush transfers end interrupt (the UI task sleeps meanwhile)
+    if (display_dma_irq_init() == false)
+    {   printf("[FAIL] Display DMA interrupt, polling transfers end\n");   }
 
     printf("[OK] Display init\n");
 }
@@ -261,47 +739,340 @@ void display_init()
 
 /* Management Functions */
 
-void manage_uptime()
+/**
+ * @details Returns the time until the next uptime update is due (ms).
+ */
+uint32_t manage_uptime()
 {
     static const uint32_t T_INCREASE_UPTIME_MS = 1000U;
     static uint32_t uptime = 0U;
     static uint32_t t0 = (uint32_t)(esp_timer_get_time() / 1000LL);
+    uint32_t t_elapsed = (uint32_t)(esp_timer_get_time() / 1000LL) - t0;
 
-    if ((uint32_t)(esp_timer_get_time() / 1000LL) - t0 >= T_INCREASE_UPTIME_MS)
+    if (t_elapsed >= T_INCREASE_UPTIME_MS)
     {
-        snprintf(text, MAX_TEXT_LENGTH, "Uptime: %lu seconds", uptime);
-        lv_label_set_text(ui_label_uptime, text);
-        printf("%s\n", text);
+        ui_post(UI_MSG_UPTIME, uptime);
+        Log.log(LOG_UPTIME, (int32_t)(uptime));
         uptime = uptime + 1U;
         t0 = (uint32_t)((esp_timer_get_time() / 1000LL));
+        t_elapsed = 0U;
     }
+
+    return T_INCREASE_UPTIME_MS - t_elapsed;
 }
 
-void manage_buzzer()
+/**
+ * @details Returns the time until the next touch read is due (ms), never
+ * in interrupt mode.
+ */
+uint32_t manage_touch()
 {
-    Buzzer.process();
+    // Touch Panel is read by the Touch Task on interrupt
+#if (IO_TOUCH_INT < 0)
+    static uint32_t t0 = 0U;
+    uint32_t t_now = (uint32_t)(esp_timer_get_time() / 1000LL);
+
+    if (t_now - t0 < ns_const::TOUCH_READ_PERIOD_MS)
+    {   return ns_const::TOUCH_READ_PERIOD_MS - (t_now - t0);   }
+    t0 = t_now;
+
+    touch_read_sample();
+    return ns_const::TOUCH_READ_PERIOD_MS;
+#else
+    return UINT32_MAX;
+#endif
 }
 
-void manage_ui()
+bool HOT_PATH touch_read_sample()
 {
-    lv_timer_handler();
+    static touch_sample_t last_sample = {0U, false, 0U, 0U};
+    touch_sample_t sample = {0U, false, 0U, 0U};
+    int pos[2] = {0, 0};
+
+    sample.timestamp_ms = (uint32_t)(esp_timer_get_time() / 1000LL);
+    TouchPanel.get_position(pos);
+    if ( (pos[0] > 0) && (pos[1] > 0) )
+    {
+        sample.pressed = true;
+        sample.x = ns_const::SCREEN_WIDTH-pos[1];
+        sample.y = pos[0];
+    }
+
+    // Publish the sample to the UI task only if something changed
+    if ( (sample.pressed == last_sample.pressed) &&
+         (sample.x == last_sample.x) && (sample.y == last_sample.y) )
+    {   return sample.pressed;   }
+    last_sample = sample;
+
+    // Queue full, drop the oldest sample
+    if (xQueueSend(touch_queue, &sample, 0) != pdTRUE)
+    {
+        touch_sample_t oldest_sample;
+        xQueueReceive(touch_queue, &oldest_sample, 0);
+        xQueueSend(touch_queue, &sample, 0);
+    }
+    ui_wake();
+
+    return sample.pressed;
+}
+
+void manage_console()
+{
+    // Non-blocking read of Serial console commands
+    int command = getchar();
+
+    if (command == 'p')
+    {   ui_post(UI_MSG_PROFILER_DUMP, 0U);   }
+    else if (command == 'r')
+    {   ui_post(UI_MSG_PROFILER_RESET, 0U);   }
+    else if (command == 'b')
+    {   ui_post(UI_MSG_DISPLAY_BENCHMARK, 0U);   }
+    else if (command == 'i')
+    {   I2CBus.dump();   }
+    else if (command == 'm')
+    {   ui_post(UI_MSG_BUZZER_MELODY, UI_MELODY_ALARM);   }
+    else if (command == 'f')
+    {   pwm_benchmark();   }
+    else if (command == 'l')
+    {
+        bool touch_logs = (Log.get_level(LOG_MODULE_TOUCH) >= LOG_LEVEL_INFO);
+        Log.set_level(LOG_MODULE_TOUCH,
+            (touch_logs) ? LOG_LEVEL_WARN : LOG_LEVEL_INFO);
+        printf("Touch logs %s\n", (touch_logs) ? "off" : "on");
+    }
+    else if ( (command >= '1') &&
+              (command < '1' + SCREEN_BUFFER_NUM_STRATEGIES) )
+    {
+        ui_post(UI_MSG_DISPLAY_BUFFER_STRATEGY,
+            static_cast<uint32_t>(command - '1'));
+    }
+}
+
+/**
+ * @details Returns the time until the next LVGL timer is due (ms), or 1 if
+ * a DMA flush transfer is in progress (its end interrupt wakes the task).
+ */
+uint32_t manage_ui()
+{
+    ui_msg_t msg;
+    uint32_t sleep_ms = 0U;
+
+    Profiler.loop_start();
+    while (xQueueReceive(ui_queue, &msg, 0) == pdTRUE)
+    {   ui_process_msg(msg);   }
+
+    // New touch samples, LVGL reads them now (not on its next read period)
+    if ( (touch_indev != nullptr) &&
+         (uxQueueMessagesWaiting(touch_queue) > 0U) )
+    {   lv_timer_ready(touch_indev->driver->read_timer);   }
+
+    sleep_ms = lv_timer_handler();
+    display_flush_complete();
+    Profiler.loop_end();
+
+    // DMA flush transfer in progress, sleep until its end interrupt wakes
+    // the task up (one tick at most, in case the interrupt is not available)
+    if (flush_pending_drv != nullptr)
+    {   sleep_ms = 1U;   }
+    return sleep_ms;
+}
+
+/*****************************************************************************/
+
+/* Thread-Safe Interface */
+
+bool ui_post(const ui_msg_id_t id, const uint32_t value)
+{
+    ui_msg_t msg = { id, value };
+
+    if (xQueueSend(ui_queue, &msg, 0) != pdTRUE)
+    {   return false;   }
+    ui_wake();
+    return true;
+}
+
+/**
+ * @details ISR version of ui_post(), the message is queued and the UI task
+ * notified with the FreeRTOS ISR API (never blocks), switching to the UI
+ * task at the ISR exit if it has a higher priority than the interrupted
+ * one.
+ */
+bool IRAM_ATTR ui_post_from_isr(const ui_msg_id_t id, const uint32_t value)
+{
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    ui_msg_t msg = { id, value };
+
+    if (xQueueSendFromISR(ui_queue, &msg, &higher_priority_task_woken)
+        != pdTRUE)
+    {   return false;   }
+    if (ui_task_handle != nullptr)
+    {   vTaskNotifyGiveFromISR(ui_task_handle, &higher_priority_task_woken);   }
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+    return true;
+}
+
+/**
+ * @details Wakes the UI task up to handle a new UI event without waiting
+ * for its next LVGL timer.
+ */
+void ui_wake()
+{
+    if (ui_task_handle != nullptr)
+    {   xTaskNotifyGive(ui_task_handle);   }
+}
+
+void ui_process_msg(const ui_msg_t& msg)
+{
+    switch (msg.id)
+    {
+        case UI_MSG_UPTIME:
+            Binder.set(UI_VALUE_UPTIME, (int32_t)(msg.value));
+            break;
+
+        case UI_MSG_PROFILER_DUMP:
+            Profiler.dump();
+            Boot.dump();
+            Coalescer.dump();
+            Log.dump();
+            Binder.dump();
+            LvglAllocator.dump();
+            ImgCache.dump();
+            tasks_wakeups_dump();
+            break;
+
+        case UI_MSG_PROFILER_RESET:
+            Profiler.reset();
+            Coalescer.reset();
+            Log.reset_stats();
+            Binder.reset();
+            LvglAllocator.reset_stats();
+            ImgCache.reset_stats();
+            tasks_wakeups_reset();
+            break;
+
+        case UI_MSG_DISPLAY_BUFFER_STRATEGY:
+            display_set_buffer_strategy(
+                static_cast<screen_buffer_strategy_t>(msg.value));
+            printf("Screen buffers: %s\n",
+                display_buffer_strategy_name(buffer_strategy));
+            lv_obj_invalidate(lv_scr_act());
+            break;
+
+        case UI_MSG_DISPLAY_BENCHMARK:
+            display_benchmark();
+            break;
+
+        case UI_MSG_BUZZER_BEEP:
+            Buzzer.beep((uint16_t)(msg.value >> 16U),
+                (uint16_t)(msg.value & 0xFFFFU));
+            break;
+
+        case UI_MSG_BUZZER_MELODY:
+            if (msg.value < UI_MELODY_NUM_MELODIES)
+            {   Buzzer.play(UI_MELODIES[msg.value]);   }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @details The UI task is the only producer of the buzzer lock-free tones
+ * queue once it runs, so this is only called from it (other tasks request
+ * melodies through ui_post(), and interrupts through
+ * buzzer_request_beep_from_isr() or ui_post_from_isr()).
+ */
+bool buzzer_request_beep(const uint16_t frequency, const uint16_t time_ms)
+{
+    return Buzzer.beep(frequency, time_ms);
+}
+
+/**
+ * @details Beep request from an ISR, forwarded to the UI task (the tones
+ * queue producer) with the beep frequency and time packed in the message
+ * value.
+ */
+bool IRAM_ATTR buzzer_request_beep_from_isr(const uint16_t frequency,
+    const uint16_t time_ms)
+{
+    return ui_post_from_isr(UI_MSG_BUZZER_BEEP,
+        ((uint32_t)(frequency) << 16U) | (uint32_t)(time_ms));
+}
+
+/**
+ * @details Called once the boot ends, the UI task plays the startup melody
+ * (if enabled, see BUZZER_STARTUP_MELODY).
+ */
+bool buzzer_startup_melody()
+{
+    if (ns_const::BUZZER_STARTUP_MELODY == false)
+    {   return false;   }
+    return ui_post(UI_MSG_BUZZER_MELODY, UI_MELODY_STARTUP);
 }
 
 /*****************************************************************************/
 
 /* LVGL UI Callbacks */
 
-void display_refresh(lv_disp_drv_t* disp_drv, const lv_area_t* area,
-    lv_color_t* color_p)
+void HOT_PATH display_refresh(lv_disp_drv_t* disp_drv,
+    const lv_area_t* area, lv_color_t* color_p)
 {
     uint32_t w = (area->x2 - area->x1 + 1U);
     uint32_t h = (area->y2 - area->y1 + 1U);
+    int64_t t0 = esp_timer_get_time();
+
+    if (lv_disp_flush_is_last(disp_drv))
+    {   Profiler.render_end();   }
+
+    // No DMA, LVGL can't keep rendering until the buffer is sent
+    if (SCREEN_BUFFER_CONFIGS[buffer_strategy].flush_dma == false)
+    {
+        Screen.startWrite();
+        Screen.setAddrWindow(area->x1, area->y1, w, h);
+        Screen.writePixels((screen_pixel_t*)&color_p->full, w * h);
+        Screen.endWrite();
+        uint32_t flush_us = (uint32_t)(esp_timer_get_time() - t0);
+        Profiler.add_wait(flush_us);
+        Profiler.add_flush(flush_us, w * h);
+        display_frame_sent(disp_drv);
+        lv_disp_flush_ready(disp_drv);
+        return;
+    }
 
+    // DMA, launch the transfer and return, so LVGL (double buffer) renders
+    // the next area into the other buffer while this one is being sent
+    // (the flush is released by display_flush_complete())
     Screen.startWrite();
     Screen.setAddrWindow(area->x1, area->y1, w, h);
-    Screen.writePixels((lgfx::rgb565_t *)&color_p->full, w * h);
-    Screen.endWrite();
-    lv_disp_flush_ready(disp_drv);
+    Screen.writePixelsDMA((screen_pixel_t*)&color_p->full, w * h);
+    flush_pending_drv = disp_drv;
+    flush_pending_t0 = t0;
+    flush_pending_px = w * h;
+    Profiler.add_wait((uint32_t)(esp_timer_get_time() - t0));
+}
+
+void HOT_PATH display_flush_wait(lv_disp_drv_t* disp_drv)
+{
+    int64_t t0 = esp_timer_get_time();
+
+    // LVGL calls this while waiting a buffer to be released (time blocked
+    // on the bus transfer is not render time)
+    display_flush_complete();
+    Profiler.add_wait((uint32_t)(esp_timer_get_time() - t0));
+}
+
+void HOT_PATH display_render_start(lv_disp_drv_t* disp_drv)
+{
+    // The previous frame last transfer ends before this one is profiled
+    // (it ended long ago unless frames are rendered back to back)
+    display_flush_wait_all();
+    Profiler.frame_start();
+
+    // LVGL only joins areas when their union is smaller than both, merge
+    // also nearby ones when that is cheaper than an extra address window
+    lv_disp_t* disp = _lv_refr_get_disp_refreshing();
+    Coalescer.coalesce(disp->inv_areas, disp->inv_area_joined, disp->inv_p);
 }
 
 void slider_event_cb(lv_event_t* event)
@@ -312,35 +1083,345 @@ void slider_event_cb(lv_event_t* event)
     if (slider == ui_slider_buzzer_freq)
     {
         buzzer_freq = static_cast<uint16_t>(slider_value);
-        snprintf(text, MAX_TEXT_LENGTH, "Buzzer Frequency: %d Hz",
-            static_cast<int>(buzzer_freq));
-        lv_label_set_text(ui_label_buzzer_freq, text);
-        printf("%s\n", text);
+        Binder.set(UI_VALUE_BUZZER_FREQ, (int32_t)(buzzer_freq));
+        Log.log(LOG_BUZZER_FREQUENCY, (int32_t)(buzzer_freq));
     }
 }
 
-void display_manage_touch(lv_indev_drv_t* indev_driver, lv_indev_data_t* data)
+void HOT_PATH display_manage_touch(lv_indev_drv_t* indev_driver,
+    lv_indev_data_t* data)
 {
-    int pos[2] = {0, 0};
+    static touch_sample_t sample = {0U, false, 0U, 0U};
 
-    touch_panel_get_position(pos);
+    // Drain next queued sample (keep last state if there is no new one),
+    // asking LVGL to read again while there are more samples queued
+    bool new_sample = (xQueueReceive(touch_queue, &sample, 0) == pdTRUE);
+    if (new_sample)
+    {   data->continue_reading = (uxQueueMessagesWaiting(touch_queue) > 0U);   }
 
-    if ( (pos[0] > 0) && (pos[1] > 0) )
+    if (sample.pressed == false)
     {
-        data->state = LV_INDEV_STATE_PR;
-        data->point.x = ns_const::SCREEN_WIDTH-pos[1];
-        data->point.y = pos[0];
+        data->state = LV_INDEV_STATE_REL;
+        return;
+    }
+
+    data->state = LV_INDEV_STATE_PR;
+    data->point.x = sample.x;
+    data->point.y = sample.y;
 
-        touch_x = static_cast<int>(data->point.x);
-        touch_y = static_cast<int>(data->point.y);
+    // Same position reported again, nothing to update nor log
+    int32_t touch_x = static_cast<int32_t>(data->point.x);
+    int32_t touch_y = static_cast<int32_t>(data->point.y);
+    if ( (new_sample == false) ||
+         ( (Binder.get(UI_VALUE_TOUCH_POSITION, 0U) == touch_x) &&
+           (Binder.get(UI_VALUE_TOUCH_POSITION, 1U) == touch_y) ) )
+    {   return;   }
 
-        snprintf(text, MAX_TEXT_LENGTH, "Touch X, Y: %u, %u",
-            touch_x, touch_y);
-        lv_label_set_text(ui_label_touch, text);
-        printf("%s\n", text);
+    Binder.set(UI_VALUE_TOUCH_POSITION, touch_x, touch_y);
+    Log.log(LOG_TOUCH_POSITION, touch_x, touch_y);
+}
+
+/**
+ * @details LVGL display refresh timer, the bound UI values changes of this
+ * frame are applied to their labels just before rendering it.
+ */
+void display_refr_timer(lv_timer_t* timer)
+{
+    Binder.apply();
+    _lv_disp_refr_timer(timer);
+}
+
+/*****************************************************************************/
+
+/* Display Flush Functions */
+
+void HOT_PATH display_flush_complete()
+{
+    // Nothing to do if there is no transfer in progress or it is not done
+    if (flush_pending_drv == nullptr)
+    {   return;   }
+    if (Screen.dmaBusy())
+    {   return;   }
+
+    // Transfer completed, close it and release the buffer to LVGL
+    lv_disp_drv_t* disp_drv = flush_pending_drv;
+    flush_pending_drv = nullptr;
+    Screen.endWrite();
+    Profiler.add_flush((uint32_t)(esp_timer_get_time() - flush_pending_t0),
+        flush_pending_px);
+    display_frame_sent(disp_drv);
+    lv_disp_flush_ready(disp_drv);
+}
+
+void display_flush_wait_all()
+{
+    while (flush_pending_drv != nullptr)
+    {   display_flush_complete();   }
+}
+
+/**
+ * @details LovyanGFX polls its LCD_CAM transfers (it has no completion
+ * callback), so the transaction done interrupt of the peripheral is
+ * enabled here, shared with any other user of it.
+ */
+bool display_dma_irq_init()
+{
+    if (esp_intr_alloc(ETS_LCD_CAM_INTR_SOURCE, ESP_INTR_FLAG_SHARED |
+        ESP_INTR_FLAG_LOWMED, isr_display_dma_done, nullptr, nullptr)
+        != ESP_OK)
+    {   return false;   }
+
+    lcd_ll_clear_interrupt_status(&LCD_CAM, LCD_LL_EVENT_TRANS_DONE);
+    lcd_ll_enable_interrupt(&LCD_CAM, LCD_LL_EVENT_TRANS_DONE, true);
+    return true;
+}
+
+/**
+ * @details Called when each flushed area has been sent, a frame is on the
+ * screen once its last area is sent (then it is profiled, and for the
+ * first frame on fast boot, the backlight is turned on).
+ */
+void HOT_PATH display_frame_sent(lv_disp_drv_t* disp_drv)
+{
+    if (lv_disp_flush_is_last(disp_drv) == false)
+    {   return;   }
+
+    Profiler.frame_end();
+    if (display_first_frame_pending == false)
+    {   return;   }
+
+    display_first_frame_pending = false;
+    Boot.mark("first_frame");
+    if (ns_const::FAST_BOOT)
+    {
+        screen_backlight_set(true);
+        Boot.mark("backlight_on");
     }
-    else
-    {   data->state = LV_INDEV_STATE_REL;   }
+}
+
+/*****************************************************************************/
+
+/* Display Render Buffers Functions */
+
+/**
+ * @details The new buffers are allocated while the current ones are still
+ * in use, and these are only released once the new ones are ready. If there
+ * is no memory for both, the current buffers are replaced by the
+ * SCREEN_BUFFER_INTERNAL_SINGLE ones and the new ones are tried again, so
+ * the display always keeps some buffers (the current ones are kept if
+ * there is no memory even for the fallback). Returns false if the requested
+ * strategy is not in use (see buffer_strategy for the one in use).
+ */
+bool display_set_buffer_strategy(const screen_buffer_strategy_t strategy)
+{
+    lv_color_t* new_buf_1 = nullptr;
+    lv_color_t* new_buf_2 = nullptr;
+
+    if (strategy >= SCREEN_BUFFER_NUM_STRATEGIES)
+    {   return false;   }
+
+    if (display_buffers_alloc(strategy, &new_buf_1, &new_buf_2))
+    {
+        display_buffers_set(strategy, new_buf_1, new_buf_2);
+        return true;
+    }
+
+    // Not enough memory for both, release the current ones for the fallback
+    if ( (strategy == SCREEN_BUFFER_INTERNAL_SINGLE) ||
+         (display_buffers_alloc(SCREEN_BUFFER_INTERNAL_SINGLE, &new_buf_1,
+            &new_buf_2) == false) )
+    {   return false;   }
+    display_buffers_set(SCREEN_BUFFER_INTERNAL_SINGLE, new_buf_1, new_buf_2);
+
+    // Retry with only the fallback buffers in use
+    if (display_buffers_alloc(strategy, &new_buf_1, &new_buf_2) == false)
+    {   return false;   }
+    display_buffers_set(strategy, new_buf_1, new_buf_2);
+
+    return true;
+}
+
+/**
+ * @details Allocates the buffers of a strategy (second one null if single
+ * buffered), returns false without any buffer if there is no memory.
+ */
+bool display_buffers_alloc(const screen_buffer_strategy_t strategy,
+    lv_color_t** new_buf_1, lv_color_t** new_buf_2)
+{
+    const screen_buffer_config_t& config = SCREEN_BUFFER_CONFIGS[strategy];
+    size_t buffer_bytes = config.buffer_size * sizeof(lv_color_t);
+
+    *new_buf_1 = static_cast<lv_color_t*>(
+        heap_caps_malloc(buffer_bytes, config.heap_caps));
+    *new_buf_2 = nullptr;
+    if (config.num_buffers > 1U)
+    {
+        *new_buf_2 = static_cast<lv_color_t*>(
+            heap_caps_malloc(buffer_bytes, config.heap_caps));
+    }
+    if ( (*new_buf_1 == nullptr) || ((config.num_buffers > 1U) &&
+         (*new_buf_2 == nullptr)) )
+    {
+        heap_caps_free(*new_buf_1);
+        heap_caps_free(*new_buf_2);
+        *new_buf_1 = nullptr;
+        *new_buf_2 = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @details Replaces the render buffers in use by the given ones, releasing
+ * the current ones once no transfer is using them.
+ */
+void display_buffers_set(const screen_buffer_strategy_t strategy,
+    lv_color_t* new_buf_1, lv_color_t* new_buf_2)
+{
+    display_flush_wait_all();
+    heap_caps_free(buf_1);
+    heap_caps_free(buf_2);
+    buf_1 = new_buf_1;
+    buf_2 = new_buf_2;
+
+    buffer_strategy = strategy;
+    lv_disp_draw_buf_init(&draw_buf, buf_1, buf_2,
+        SCREEN_BUFFER_CONFIGS[strategy].buffer_size);
+}
+
+const char* display_buffer_strategy_name(
+    const screen_buffer_strategy_t strategy)
+{
+    if (strategy >= SCREEN_BUFFER_NUM_STRATEGIES)
+    {   return "unknown";   }
+    return SCREEN_BUFFER_CONFIGS[strategy].name;
+}
+
+void display_benchmark()
+{
+    using namespace ns_const;
+
+    screen_buffer_strategy_t initial_strategy = buffer_strategy;
+
+    printf("\n[Screen Buffers Benchmark] %lu full screen frames\n",
+        (uint32_t)(SCREEN_BENCHMARK_FRAMES));
+    printf("  %-16s %10s %14s %12s\n", "Strategy", "FPS",
+        "Internal RAM", "PSRAM");
+
+    for (uint8_t i = 0U; i < SCREEN_BUFFER_NUM_STRATEGIES; i++)
+    {
+        screen_buffer_strategy_t strategy =
+            static_cast<screen_buffer_strategy_t>(i);
+
+        // Measure memory cost of the strategy buffers, allocated while the
+        // current ones are still in use (kept if there is no memory)
+        lv_color_t* new_buf_1 = nullptr;
+        lv_color_t* new_buf_2 = nullptr;
+        size_t internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+        size_t psram_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+        if (display_buffers_alloc(strategy, &new_buf_1, &new_buf_2) == false)
+        {
+            printf("  %-16s (not enough memory)\n",
+                display_buffer_strategy_name(strategy));
+            continue;
+        }
+        size_t internal_cost = internal_free -
+            heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+        size_t psram_cost = psram_free -
+            heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+        display_buffers_set(strategy, new_buf_1, new_buf_2);
+
+        // Render the current screen from scratch
+        int64_t t0 = esp_timer_get_time();
+        for (uint32_t frame = 0U; frame < SCREEN_BENCHMARK_FRAMES; frame++)
+        {
+            lv_obj_invalidate(lv_scr_act());
+            lv_refr_now(NULL);
+        }
+        display_flush_wait_all();
+        int64_t t_elapsed_us = esp_timer_get_time() - t0;
+
+        uint32_t fps_x10 = 0U;
+        if (t_elapsed_us > 0)
+        {
+            fps_x10 = (uint32_t)((SCREEN_BENCHMARK_FRAMES * 10000000LL) /
+                t_elapsed_us);
+        }
+        printf("  %-16s %7lu.%lu %8lu Bytes %6lu Bytes\n",
+            display_buffer_strategy_name(strategy), fps_x10 / 10U,
+            fps_x10 % 10U, (uint32_t)(internal_cost), (uint32_t)(psram_cost));
+    }
+
+    // Restore strategy (or its fallback) and discard the benchmark frames
+    // from the profiler
+    if (display_set_buffer_strategy(initial_strategy) == false)
+    {
+        printf("[FAIL] Screen buffers %s, using %s\n",
+            display_buffer_strategy_name(initial_strategy),
+            display_buffer_strategy_name(buffer_strategy));
+    }
+    Profiler.reset();
+}
+
+/*****************************************************************************/
+
+/* PWM Functions */
+
+/**
+ * @details Sweeps the buzzer frequencies range on a free PWM channel (with
+ * its own timer and no output pin), measuring the time of each frequency
+ * change through the fast path (ledc_set_freq()) and through a full LEDC
+ * timer configuration (channel released and allocated again).
+ */
+void pwm_benchmark()
+{
+    using namespace ns_const;
+
+    uint32_t freq_step = (BUZZER_MAX_FREQ_HZ - BUZZER_MIN_FREQ_HZ) /
+        PWM_BENCHMARK_STEPS;
+    int64_t t_fast = 0;
+    int64_t t_full = 0;
+    uint32_t fails = 0U;
+
+    int8_t chan = ledc_alloc(LEDC_ANY_CHANNEL, LEDC_NO_PIN,
+        BUZZER_MIN_FREQ_HZ, 10U, true);
+    if (chan < 0)
+    {
+        printf("\n[PWM Frequency Change Benchmark] No free PWM channel\n");
+        return;
+    }
+    ledc_dump();
+
+    for (uint32_t i = 0U; i < PWM_BENCHMARK_STEPS; i++)
+    {
+        uint32_t freq = BUZZER_MIN_FREQ_HZ + ((i + 1U) * freq_step);
+        int64_t t0 = esp_timer_get_time();
+        if (ledc_change_frequency(chan, freq) == 0U)
+        {   fails = fails + 1U;   }
+        t_fast = t_fast + (esp_timer_get_time() - t0);
+    }
+    for (uint32_t i = 0U; (i < PWM_BENCHMARK_STEPS) && (chan >= 0); i++)
+    {
+        uint32_t freq = BUZZER_MIN_FREQ_HZ + ((i + 1U) * freq_step);
+        int64_t t0 = esp_timer_get_time();
+        ledc_free(chan);
+        chan = ledc_alloc(chan, LEDC_NO_PIN, freq, 10U, true);
+        if (chan < 0)
+        {   fails = fails + 1U;   }
+        t_full = t_full + (esp_timer_get_time() - t0);
+    }
+    if (chan >= 0)
+    {   ledc_free(chan);   }
+
+    printf("\n[PWM Frequency Change Benchmark] %lu steps (%u..%u Hz)\n",
+        (unsigned long)(PWM_BENCHMARK_STEPS), BUZZER_MIN_FREQ_HZ,
+        BUZZER_MAX_FREQ_HZ);
+    printf("  Fast path (ledc_set_freq): %lu us/change\n",
+        (unsigned long)(t_fast / PWM_BENCHMARK_STEPS));
+    printf("  Full timer config:         %lu us/change\n",
+        (unsigned long)(t_full / PWM_BENCHMARK_STEPS));
+    printf("  Failed changes: %lu\n", (unsigned long)(fails));
 }
 
 /*****************************************************************************/
@@ -350,6 +1431,7 @@ void display_manage_touch(lv_indev_drv_t* indev_driver, lv_indev_data_t* data)
 void ui_draw_screen_1()
 {
     using namespace ns_const;
+    static const uint32_t INFO_TEXT_MAX_LENGTH = 256U;
 
     // Container
     ui_info_box = lv_obj_create(lv_scr_act());
@@ -362,7 +1444,8 @@ void ui_draw_screen_1()
     /* Label Info */
     ui_label_info = lv_label_create(ui_info_box);
     lv_obj_set_style_text_color(ui_label_info, COLOR_WHITE, LV_PART_MAIN);
-    snprintf(text, MAX_TEXT_LENGTH,
+    char text[INFO_TEXT_MAX_LENGTH];
+    snprintf(text, INFO_TEXT_MAX_LENGTH,
         "Project: %s\n"
         "FW Version: v%d.%d.%d (%s %s)\n"
         "ESP-IDF Version: %s\n"
@@ -375,14 +1458,14 @@ void ui_draw_screen_1()
     /* Label Uptime */
     ui_label_uptime = lv_label_create(ui_info_box);
     lv_obj_set_style_text_color(ui_label_uptime, COLOR_WHITE, LV_PART_MAIN);
-    snprintf(text, MAX_TEXT_LENGTH, "Uptime: 0 seconds");
-    lv_label_set_text(ui_label_uptime, text);
+    Binder.bind_label(UI_VALUE_UPTIME, ui_label_uptime,
+        "Uptime: %lu seconds");
 
     /* Buzzer Frequency Label */
     ui_label_buzzer_freq = lv_label_create(lv_scr_act());
-    snprintf(text, MAX_TEXT_LENGTH, "Buzzer Frequency: %d Hz",
-        static_cast<int>(buzzer_freq));
-    lv_label_set_text(ui_label_buzzer_freq, text);
+    Binder.set(UI_VALUE_BUZZER_FREQ, (int32_t)(buzzer_freq));
+    Binder.bind_label(UI_VALUE_BUZZER_FREQ, ui_label_buzzer_freq,
+        "Buzzer Frequency: %ld Hz");
     lv_obj_set_style_text_color(ui_label_buzzer_freq,
         COLOR_ORANGE, LV_PART_MAIN);
     lv_obj_align(ui_label_buzzer_freq, LV_ALIGN_CENTER, 0, 20);
@@ -406,8 +1489,8 @@ void ui_draw_screen_1()
         lv_event_code_t code = lv_event_get_code(event);
         if (code == LV_EVENT_CLICKED)
         {
-            Buzzer.beep(buzzer_freq, 100U);
-            printf("Button beep pressed\n");
+            buzzer_request_beep(buzzer_freq, 100U);
+            Log.log(LOG_BUTTON_BEEP);
         }
     }, LV_EVENT_ALL, NULL);
 
@@ -416,20 +1499,66 @@ void ui_draw_screen_1()
     lv_obj_align(ui_label_touch, LV_ALIGN_BOTTOM_MID, 0, -15);
     lv_obj_set_style_text_color(ui_label_touch, COLOR_GREEN,
         LV_PART_MAIN);
-    snprintf(text, MAX_TEXT_LENGTH, "Touch X, Y: 000, 000");
-    lv_label_set_text(ui_label_touch, text);
+    Binder.bind_label(UI_VALUE_TOUCH_POSITION, ui_label_touch,
+        "Touch X, Y: %03ld, %03ld");
 }
 
 /*****************************************************************************/
 
 /* Auxiliary Function */
 
-bool touch_i2c_read_register(const uint16_t slave_address,
-    const uint8_t reg_address, uint8_t* data_read)
+/**
+ * @details Reads the Touch Panel ID through the I2C Scheduler at the given
+ * frequency (the scheduler sets the bus clock from the request device).
+ */
+bool touch_i2c_probe_read(const uint32_t frequency)
+{
+    i2c_device_t device = { FT6236<TouchI2C>::I2C_ADDRESS,
+        I2C_PRIORITY_TOUCH, ns_const::TOUCH_I2C_DEADLINE_MS, frequency };
+    uint8_t id[TOUCH_PANEL_ID_LENGTH];
+
+    if (I2CBus.read_registers_sync(device,
+        FT6236<TouchI2C>::REG_LIB_VERSION_H, id, TOUCH_PANEL_ID_LENGTH)
+        != I2C_RESULT_OK)
+    {   return false;   }
+    return (memcmp(id, touch_id, TOUCH_PANEL_ID_LENGTH) == 0);
+}
+
+/**
+ * @details Converts a time in ms to FreeRTOS ticks rounding up, so a short
+ * wait never becomes a zero ticks busy-loop with a low tick rate (i.e. 5ms
+ * at 100Hz). A wait without deadline (LVGL no timer ready) blocks forever.
+ */
+TickType_t ms_to_ticks_ceil(const uint32_t ms)
+{
+    if (ms == UINT32_MAX)
+    {   return portMAX_DELAY;   }
+    return (TickType_t)(((uint64_t)(ms) + portTICK_PERIOD_MS - 1U) /
+        portTICK_PERIOD_MS);
+}
+
+/*****************************************************************************/
+
+/* Tasks Wake-ups */
+
+void tasks_wakeups_dump()
+{
+    int64_t t_elapsed_ms = (esp_timer_get_time() - t_wakeups_reset) / 1000LL;
+
+    if (t_elapsed_ms <= 0)
+    {   t_elapsed_ms = 1;   }
+    printf("Wake-ups in %lu ms: UI task %lu (%lu/s), Main task %lu (%lu/s)\n",
+        (unsigned long)(t_elapsed_ms), (unsigned long)(ui_task_wakeups),
+        (unsigned long)((ui_task_wakeups * 1000LL) / t_elapsed_ms),
+        (unsigned long)(main_task_wakeups),
+        (unsigned long)((main_task_wakeups * 1000LL) / t_elapsed_ms));
+}
+
+void tasks_wakeups_reset()
 {
-    bool result = i2c_read_register(I2C_PORT_TOUCH,
-        slave_address, reg_address, data_read);
-    return result;
+    ui_task_wakeups = 0U;
+    main_task_wakeups = 0U;
+    t_wakeups_reset = esp_timer_get_time();
 }
 
 /*****************************************************************************/
@@ -0,0 +1,68 @@
+/**
+ * @file    hot_path.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Render and touch hot paths code placement (IRAM in release builds).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef HOT_PATH_H
+#define HOT_PATH_H
+
+/*****************************************************************************/
+
+/* Defines */
+
+#define HOT_PATH_STR_(x) #x
+#define HOT_PATH_STR(x) HOT_PATH_STR_(x)
+
+/*****************************************************************************/
+
+/* Macros */
+
+// Hot path functions go to their own ".hot_path.N" sections, that the
+// src/linker.lf fragment places in IRAM on release builds (out of flash
+// cache misses) and in flash on debug builds
+#if defined(NATIVE_BUILD)
+    #define HOT_PATH
+#else
+    #define HOT_PATH \
+        __attribute__((section(".hot_path." HOT_PATH_STR(__COUNTER__))))
+#endif
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* HOT_PATH_H */
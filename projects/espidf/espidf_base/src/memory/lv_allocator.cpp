@@ -0,0 +1,72 @@
+/**
+ * @file    lv_allocator.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * LVGL memory allocator functions (LV_MEM_CUSTOM), backed by the project tiered allocator.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "lv_allocator.h"
+
+// Tiered Allocator
+#include "memory/tiered_allocator.h"
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+// LVGL Allocator (only used from the LVGL task)
+TieredAllocator LvglAllocator;
+
+/*****************************************************************************/
+
+/* Public Functions */
+
+void* lv_allocator_malloc(size_t size)
+{
+    return LvglAllocator.malloc(size);
+}
+
+void* lv_allocator_realloc(void* ptr, size_t size)
+{
+    return LvglAllocator.realloc(ptr, size);
+}
+
+void lv_allocator_free(void* ptr)
+{
+    LvglAllocator.free(ptr);
+}
+
+/*****************************************************************************/
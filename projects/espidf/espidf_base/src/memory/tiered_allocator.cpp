@@ -0,0 +1,407 @@
+/**
+ * @file    tiered_allocator.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Tiered allocator (internal SRAM slab pools for small blocks, internal heap for medium ones and PSRAM for large ones).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "tiered_allocator.h"
+
+// Standard C++ Libraries
+#include <cstdio>
+#include <cstring>
+
+// ESP-IDF Framework
+#include "esp_heap_caps.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Tiers names (dump)
+static const char* TIER_NAMES[TieredAllocator::NUM_TIERS] =
+{
+    "slab",
+    "internal",
+    "psram"
+};
+
+// Tiers heap memory capabilities
+static const uint32_t TIER_CAPS[TieredAllocator::NUM_TIERS] =
+{
+    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+    MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT
+};
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+TieredAllocator::TieredAllocator()
+{
+    initialized = false;
+    arena = nullptr;
+    arena_size = 0U;
+    for (uint8_t i = 0U; i < NUM_CLASSES; i++)
+    {
+        class_start[i] = nullptr;
+        free_lists[i] = nullptr;
+    }
+    trace_cb = nullptr;
+    memset(class_stats, 0, sizeof(class_stats));
+    memset(tier_stats, 0, sizeof(tier_stats));
+}
+
+/**
+ * @details Allocates the slab pools arena from internal SRAM and builds the
+ * free list of each class. If there is no memory for it, all the blocks go
+ * to the heap tiers. It is called on the first allocation if not before.
+ */
+bool TieredAllocator::init()
+{
+    if (initialized)
+    {   return (arena != nullptr);   }
+    initialized = true;
+
+    size_t size = 0U;
+    for (uint8_t i = 0U; i < NUM_CLASSES; i++)
+    {   size = size + (CLASS_SIZES[i] * CLASS_BLOCKS[i]);   }
+    arena = static_cast<uint8_t*>(heap_caps_malloc(size,
+        TIER_CAPS[TIER_SLAB]));
+    if (arena == nullptr)
+    {   return false;   }
+    arena_size = size;
+
+    uint8_t* block = arena;
+    for (uint8_t i = 0U; i < NUM_CLASSES; i++)
+    {
+        class_start[i] = block;
+        for (uint16_t n = 0U; n < CLASS_BLOCKS[i]; n++)
+        {
+            free_block_t* free_block = reinterpret_cast<free_block_t*>(block);
+            free_block->next = free_lists[i];
+            free_lists[i] = free_block;
+            block = block + CLASS_SIZES[i];
+        }
+    }
+
+    return true;
+}
+
+void* TieredAllocator::malloc(const size_t size)
+{
+    if (initialized == false)
+    {   init();   }
+
+    void* ptr = alloc_block(size);
+    if ( (ptr != nullptr) && (trace_cb != nullptr) )
+    {   trace_cb(TRACE_ALLOC, ptr, nullptr, size);   }
+    return ptr;
+}
+
+/**
+ * @details A slab block is kept if the new size still fits in it, and a
+ * heap block of the same tier is resized in place by the heap. Otherwise
+ * the data is moved to a new block of the right tier (the old block is kept
+ * if there is no memory for it).
+ */
+void* TieredAllocator::realloc(void* ptr, const size_t size)
+{
+    if (ptr == nullptr)
+    {   return malloc(size);   }
+    if (size == 0U)
+    {
+        free(ptr);
+        return nullptr;
+    }
+
+    void* new_ptr = nullptr;
+    int8_t size_class = slab_class(ptr);
+    if ( (size_class >= 0) && (size <= CLASS_SIZES[size_class]) )
+    {   new_ptr = ptr;   }
+    else if ( (size_class < 0) && (size > CLASS_SIZES[NUM_CLASSES - 1U]) )
+    {
+        block_header_t* header = static_cast<block_header_t*>(ptr) - 1;
+        tier_t tier = (size > PSRAM_THRESHOLD) ? TIER_PSRAM : TIER_INTERNAL;
+        if (header->tier == tier)
+        {
+            size_t old_size = header->size;
+            header = static_cast<block_header_t*>(heap_caps_realloc(header,
+                sizeof(block_header_t) + size, TIER_CAPS[tier]));
+            if (header != nullptr)
+            {
+                tier_remove(tier, old_size);
+                tier_add(tier, size);
+                header->size = size;
+                new_ptr = header + 1;
+            }
+        }
+    }
+
+    if (new_ptr == nullptr)
+    {
+        new_ptr = alloc_block(size);
+        if (new_ptr == nullptr)
+        {   return nullptr;   }
+        size_t old_size = block_size(ptr);
+        memcpy(new_ptr, ptr, (old_size < size) ? old_size : size);
+        free_block(ptr);
+    }
+
+    if (trace_cb != nullptr)
+    {   trace_cb(TRACE_REALLOC, new_ptr, ptr, size);   }
+    return new_ptr;
+}
+
+void TieredAllocator::free(void* ptr)
+{
+    if (ptr == nullptr)
+    {   return;   }
+
+    free_block(ptr);
+    if (trace_cb != nullptr)
+    {   trace_cb(TRACE_FREE, nullptr, ptr, 0U);   }
+}
+
+void TieredAllocator::set_trace(trace_cb_t trace_cb)
+{
+    this->trace_cb = trace_cb;
+}
+
+const TieredAllocator::class_stats_t& TieredAllocator::get_class_stats(
+    const uint8_t size_class)
+{
+    return class_stats[size_class];
+}
+
+const TieredAllocator::tier_stats_t& TieredAllocator::get_tier_stats(
+    const tier_t tier)
+{
+    return tier_stats[tier];
+}
+
+/**
+ * @details The blocks in use are kept (and so the high-water marks start
+ * from them).
+ */
+void TieredAllocator::reset_stats()
+{
+    for (uint8_t i = 0U; i < NUM_CLASSES; i++)
+    {
+        class_stats_t& stats = class_stats[i];
+        stats.used_max = stats.used;
+        stats.allocs = 0U;
+        stats.overflows = 0U;
+        stats.bytes_requested = 0U;
+        stats.bytes_allocated = 0U;
+    }
+    for (uint8_t i = 0U; i < NUM_TIERS; i++)
+    {
+        tier_stats_t& stats = tier_stats[i];
+        stats.used_max = stats.used;
+        stats.allocs = 0U;
+        stats.fails = 0U;
+    }
+}
+
+void TieredAllocator::dump()
+{
+    printf("\n[Tiered Allocator] Slab arena: %lu Bytes\n",
+        (unsigned long)(arena_size));
+    printf("  %-8s %6s %11s %8s %9s %6s\n", "Class", "Used", "Max/Blocks",
+        "Allocs", "Overflows", "Frag");
+    for (uint8_t i = 0U; i < NUM_CLASSES; i++)
+    {
+        const class_stats_t& stats = class_stats[i];
+        uint32_t frag_pct = 0U;
+        if (stats.bytes_allocated > 0U)
+        {
+            frag_pct = (uint32_t)(100U - ((stats.bytes_requested * 100U) /
+                stats.bytes_allocated));
+        }
+        printf("  %4lu B   %6u %5u/%-5u %8lu %9lu %5lu%%\n",
+            (unsigned long)(CLASS_SIZES[i]), (unsigned)(stats.used),
+            (unsigned)(stats.used_max), (unsigned)(CLASS_BLOCKS[i]),
+            (unsigned long)(stats.allocs), (unsigned long)(stats.overflows),
+            (unsigned long)(frag_pct));
+    }
+    printf("  %-8s %10s %10s %8s %6s\n", "Tier", "Used", "Max", "Allocs",
+        "Fails");
+    for (uint8_t i = 0U; i < NUM_TIERS; i++)
+    {
+        const tier_stats_t& stats = tier_stats[i];
+        printf("  %-8s %10lu %10lu %8lu %6lu\n", TIER_NAMES[i],
+            (unsigned long)(stats.used), (unsigned long)(stats.used_max),
+            (unsigned long)(stats.allocs), (unsigned long)(stats.fails));
+    }
+
+    // Heap tiers external fragmentation (largest block vs free memory)
+    for (uint8_t i = TIER_INTERNAL; i < NUM_TIERS; i++)
+    {
+        size_t free_size = heap_caps_get_free_size(TIER_CAPS[i]);
+        size_t largest = heap_caps_get_largest_free_block(TIER_CAPS[i]);
+        uint32_t frag_pct = (free_size > 0U) ?
+            (uint32_t)(100U - ((largest * 100U) / free_size)) : 0U;
+        printf("  %s heap: %lu Bytes free, largest block %lu Bytes "
+            "(%lu%% fragmented)\n", TIER_NAMES[i], (unsigned long)(free_size),
+            (unsigned long)(largest), (unsigned long)(frag_pct));
+    }
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+void* TieredAllocator::alloc_block(const size_t size)
+{
+    for (uint8_t i = 0U; i < NUM_CLASSES; i++)
+    {
+        if (size > CLASS_SIZES[i])
+        {   continue;   }
+
+        class_stats_t& stats = class_stats[i];
+        free_block_t* block = free_lists[i];
+        if (block == nullptr)
+        {
+            stats.overflows = stats.overflows + 1U;
+            break;
+        }
+        free_lists[i] = block->next;
+        stats.used = stats.used + 1U;
+        if (stats.used > stats.used_max)
+        {   stats.used_max = stats.used;   }
+        stats.allocs = stats.allocs + 1U;
+        stats.bytes_requested = stats.bytes_requested + size;
+        stats.bytes_allocated = stats.bytes_allocated + CLASS_SIZES[i];
+        tier_add(TIER_SLAB, CLASS_SIZES[i]);
+        return block;
+    }
+
+    return heap_alloc(size);
+}
+
+/**
+ * @details Falls back to the other heap tier if the preferred one has no
+ * memory for the block.
+ */
+void* TieredAllocator::heap_alloc(const size_t size)
+{
+    tier_t tier = (size > PSRAM_THRESHOLD) ? TIER_PSRAM : TIER_INTERNAL;
+    block_header_t* header = static_cast<block_header_t*>(heap_caps_malloc(
+        sizeof(block_header_t) + size, TIER_CAPS[tier]));
+
+    if (header == nullptr)
+    {
+        tier_stats[tier].fails = tier_stats[tier].fails + 1U;
+        tier = (tier == TIER_PSRAM) ? TIER_INTERNAL : TIER_PSRAM;
+        header = static_cast<block_header_t*>(heap_caps_malloc(
+            sizeof(block_header_t) + size, TIER_CAPS[tier]));
+        if (header == nullptr)
+        {
+            tier_stats[tier].fails = tier_stats[tier].fails + 1U;
+            return nullptr;
+        }
+    }
+
+    header->size = static_cast<uint32_t>(size);
+    header->tier = tier;
+    tier_add(tier, size);
+    return (header + 1);
+}
+
+void TieredAllocator::free_block(void* ptr)
+{
+    int8_t size_class = slab_class(ptr);
+
+    if (size_class >= 0)
+    {
+        free_block_t* block = static_cast<free_block_t*>(ptr);
+        block->next = free_lists[size_class];
+        free_lists[size_class] = block;
+        class_stats[size_class].used = class_stats[size_class].used - 1U;
+        tier_remove(TIER_SLAB, CLASS_SIZES[size_class]);
+        return;
+    }
+
+    block_header_t* header = static_cast<block_header_t*>(ptr) - 1;
+    tier_remove(static_cast<tier_t>(header->tier), header->size);
+    heap_caps_free(header);
+}
+
+/**
+ * @details Returns the slab class of the block, or -1 if it is not a slab
+ * block (out of the arena).
+ */
+int8_t TieredAllocator::slab_class(const void* ptr)
+{
+    const uint8_t* block = static_cast<const uint8_t*>(ptr);
+
+    if ( (arena == nullptr) || (block < arena) ||
+         (block >= arena + arena_size) )
+    {   return -1;   }
+
+    int8_t size_class = NUM_CLASSES - 1;
+    while (block < class_start[size_class])
+    {   size_class = size_class - 1;   }
+    return size_class;
+}
+
+size_t TieredAllocator::block_size(const void* ptr)
+{
+    int8_t size_class = slab_class(ptr);
+
+    if (size_class >= 0)
+    {   return CLASS_SIZES[size_class];   }
+    return (static_cast<const block_header_t*>(ptr) - 1)->size;
+}
+
+void TieredAllocator::tier_add(const tier_t tier, const size_t size)
+{
+    tier_stats_t& stats = tier_stats[tier];
+
+    stats.used = stats.used + size;
+    if (stats.used > stats.used_max)
+    {   stats.used_max = stats.used;   }
+    stats.allocs = stats.allocs + 1U;
+}
+
+void TieredAllocator::tier_remove(const tier_t tier, const size_t size)
+{
+    tier_stats[tier].used = tier_stats[tier].used - size;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,207 @@
+/**
+ * @file    tiered_allocator.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Tiered allocator (internal SRAM slab pools for small blocks, internal heap for medium ones and PSRAM for large ones).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef TIERED_ALLOCATOR_H
+#define TIERED_ALLOCATOR_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @details Small blocks are taken from fixed size classes slab pools carved
+ * from one internal SRAM arena (no header, free lists), falling back to the
+ * internal heap when their class is exhausted. Bigger blocks get a small
+ * header (size and tier) and come from the internal heap, or from PSRAM
+ * above the PSRAM threshold. Not thread-safe (LVGL runs in one task).
+ */
+class TieredAllocator
+{
+    public:
+
+        /**
+         * @brief Number of slab size classes.
+         */
+        static constexpr uint8_t NUM_CLASSES = 5U;
+
+        /**
+         * @brief Slab classes block size (Bytes) and number of blocks.
+         */
+        static constexpr size_t CLASS_SIZES[NUM_CLASSES] =
+            { 16U, 32U, 64U, 128U, 256U };
+        static constexpr uint16_t CLASS_BLOCKS[NUM_CLASSES] =
+            { 128U, 128U, 96U, 64U, 32U };
+
+        /**
+         * @brief Blocks above this size are allocated in PSRAM (Bytes).
+         */
+        static constexpr size_t PSRAM_THRESHOLD = 2048U;
+
+        /**
+         * @brief Memory tiers.
+         */
+        enum tier_t
+        {
+            TIER_SLAB = 0,
+            TIER_INTERNAL,
+            TIER_PSRAM,
+            NUM_TIERS
+        };
+
+        /**
+         * @brief Traced operations.
+         */
+        enum trace_op_t
+        {
+            TRACE_ALLOC = 0,
+            TRACE_REALLOC,
+            TRACE_FREE
+        };
+
+        /**
+         * @brief Trace callback, called after each successful operation
+         * (old_ptr is the reallocated or freed block).
+         */
+        typedef void (*trace_cb_t)(const trace_op_t op, const void* ptr,
+            const void* old_ptr, const size_t size);
+
+        /**
+         * @brief Slab class statistics (requested and block Bytes of all
+         * the allocations, their ratio is the internal fragmentation).
+         */
+        struct class_stats_t
+        {
+            uint16_t used;
+            uint16_t used_max;
+            uint32_t allocs;
+            uint32_t overflows;
+            uint64_t bytes_requested;
+            uint64_t bytes_allocated;
+        };
+
+        /**
+         * @brief Tier statistics.
+         */
+        struct tier_stats_t
+        {
+            size_t used;
+            size_t used_max;
+            uint32_t allocs;
+            uint32_t fails;
+        };
+
+        TieredAllocator();
+
+        bool init();
+
+        void* malloc(const size_t size);
+
+        void* realloc(void* ptr, const size_t size);
+
+        void free(void* ptr);
+
+        void set_trace(trace_cb_t trace_cb);
+
+        const class_stats_t& get_class_stats(const uint8_t size_class);
+
+        const tier_stats_t& get_tier_stats(const tier_t tier);
+
+        void reset_stats();
+
+        void dump();
+
+    /******************************************************************/
+
+    private:
+
+        /**
+         * @brief Free slab block (free list node).
+         */
+        struct free_block_t
+        {
+            free_block_t* next;
+        };
+
+        /**
+         * @brief Header of the internal heap and PSRAM blocks.
+         */
+        struct block_header_t
+        {
+            uint32_t size;
+            uint32_t tier;
+        };
+
+        bool initialized;
+        uint8_t* arena;
+        size_t arena_size;
+        uint8_t* class_start[NUM_CLASSES];
+        free_block_t* free_lists[NUM_CLASSES];
+        trace_cb_t trace_cb;
+
+        class_stats_t class_stats[NUM_CLASSES];
+        tier_stats_t tier_stats[NUM_TIERS];
+
+        void* alloc_block(const size_t size);
+
+        void* heap_alloc(const size_t size);
+
+        void free_block(void* ptr);
+
+        int8_t slab_class(const void* ptr);
+
+        size_t block_size(const void* ptr);
+
+        void tier_add(const tier_t tier, const size_t size);
+
+        void tier_remove(const tier_t tier, const size_t size);
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* TIERED_ALLOCATOR_H */
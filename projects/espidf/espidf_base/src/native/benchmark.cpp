@@ -0,0 +1,555 @@
+/**
+ * @file    benchmark.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) headless UI frame-rendering benchmark.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Unit Tests Build Guard (native tests have their own main function) */
+
+#if !defined(PIO_UNIT_TESTING)
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// ESP-IDF Framework
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+// Graphic Libraies
+#include <lvgl.h>
+
+// Project Headers
+#include "config/config.h"
+#include "config/config_screen.h"
+#include "display/area_coalescer.h"
+#include "display/image_cache.h"
+#include "hal/i2c_mock.h"
+#include "memory/tiered_allocator.h"
+#include "native/native.h"
+#include "native/native_alloc_trace.h"
+#include "native/native_app.h"
+#include "touch_panel/driver_ft6236.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Scripted benchmark phase.
+ */
+struct bench_phase_t
+{
+    const char* name;
+    uint32_t frames;
+    void (*touch_script)(const uint32_t frame, const uint32_t frames);
+};
+
+/**
+ * @brief Invalidated areas of one frame, to be replayed on the coalescer.
+ */
+struct bench_areas_t
+{
+    const char* name;
+    uint16_t num_areas;
+    lv_area_t areas[4];
+};
+
+/**
+ * @brief Touch Panel I2C transport through a function pointer (the run-time
+ * dispatch that the driver used before its compile-time I2C policy), to the
+ * mocked device.
+ */
+struct bench_callback_i2c_t
+{
+    static inline bool (*read)(const uint16_t, const uint8_t, uint8_t*,
+        const size_t) = MockI2C::read_registers;
+    static inline bool (*write)(const uint16_t, const uint8_t,
+        const uint8_t) = MockI2C::write_register;
+
+    static bool read_registers(const uint16_t address, const uint8_t reg,
+        uint8_t* data, const size_t length)
+    {   return read(address, reg, data, length);   }
+
+    static bool write_register(const uint16_t address, const uint8_t reg,
+        const uint8_t value)
+    {   return write(address, reg, value);   }
+};
+
+/*****************************************************************************/
+
+/* Function Prototypes */
+
+static void run_phase(const bench_phase_t& phase);
+static void run_areas_replay();
+static void run_touch_speeds();
+static void run_touch_dispatch();
+static void run_alloc_trace_replay();
+static void run_image_cache();
+static double image_cache_redraw(lv_obj_t* obj, const uint32_t frames);
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+// Tiered allocator to replay the LVGL allocations trace on
+static TieredAllocator ReplayAllocator;
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Scripted Benchmark Phases
+static const bench_phase_t BENCH_PHASES[] =
+{
+    { "first_frame", 1U, nullptr },
+    { "idle", 200U, nullptr },
+    { "slider_drag", 100U,
+        [](const uint32_t frame, const uint32_t frames)
+        {
+            if (frame == frames - 1U)
+            {   native_touch_release();   return;   }
+            native_touch_press(NATIVE_SLIDER_X_START +
+                ((NATIVE_SLIDER_WIDTH * frame) / frames), NATIVE_SLIDER_Y);
+        }
+    },
+    { "button_taps", 100U,
+        [](const uint32_t frame, const uint32_t frames)
+        {
+            if ((frame % 20U) < 5U)
+            {   native_touch_press(NATIVE_BUTTON_X, NATIVE_BUTTON_Y);   }
+            else
+            {   native_touch_release();   }
+        }
+    },
+};
+
+// Invalidation patterns of screen 1 (areas that LVGL invalidates on each
+// kind of UI update, after its own join of overlapping areas)
+static const bench_areas_t BENCH_AREAS[] =
+{
+    { "uptime_label", 1U, { {144, 94, 335, 109} } },
+    { "slider_drag", 3U, { {164, 171, 315, 186}, {112, 191, 247, 210},
+        {240, 191, 370, 210} } },
+    { "touch_label", 2U, { {172, 289, 307, 304}, {196, 225, 283, 259} } },
+    { "scattered_labels", 3U, { {144, 94, 335, 109}, {164, 171, 315, 186},
+        {172, 289, 307, 304} } },
+};
+
+// Address window costs (pixels) replayed on the invalidation patterns
+static const uint32_t BENCH_WINDOW_COSTS_PX[] =
+    { 0U, 100U, ns_const::SCREEN_AREA_WINDOW_COST_PX, 2000U };
+
+// Number of touch samples read on each I2C frequency, and the frequencies
+static constexpr uint32_t BENCH_TOUCH_SPEED_SAMPLES = 100U;
+static const uint32_t BENCH_I2C_FREQUENCIES_HZ[] =
+    { 100000UL, 400000UL, 1000000UL };
+
+// Touch Panel sample registers (TD_STATUS to YL)
+static constexpr uint8_t BENCH_TOUCH_REG_TD_STATUS = 0x02U;
+static constexpr uint8_t BENCH_TOUCH_SAMPLE_NUM_REGS = 5U;
+
+// Number of touch samples decoded by the touch driver dispatch benchmark
+static constexpr uint32_t BENCH_TOUCH_DISPATCH_SAMPLES = 1000000U;
+
+// Image cache benchmark icons (alpha 4-bit, decoded line by line), number
+// of sources, objects showing each one and redrawn frames
+static constexpr lv_coord_t BENCH_IMG_ICON_PX = 32;
+static constexpr uint8_t BENCH_IMG_SOURCES = 4U;
+static constexpr uint8_t BENCH_IMG_COPIES = 3U;
+static constexpr uint32_t BENCH_IMG_FRAMES = 20U;
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    // Record the LVGL allocations of the whole UI run
+    LvglAllocator.set_trace(native_alloc_trace_record);
+
+    // Initializations
+    native_app_init();
+
+    // Run Scripted Frames
+    printf("\n[Benchmark] Screen %ux%u, frame period %u ms\n",
+        ns_const::SCREEN_WIDTH, ns_const::SCREEN_HEIGHT,
+        NATIVE_FRAME_PERIOD_MS);
+    for (const bench_phase_t& phase : BENCH_PHASES)
+    {   run_phase(phase);   }
+    LvglAllocator.set_trace(nullptr);
+    run_areas_replay();
+    run_alloc_trace_replay();
+    run_touch_speeds();
+    run_touch_dispatch();
+    run_image_cache();
+
+    native_heap_stats_t heap = native_heap_stats();
+    printf("\n[Benchmark] Heap: peak %zu Bytes, in use %zu Bytes, "
+        "%lu allocs, %lu frees\n", heap.peak, heap.used,
+        (unsigned long)(heap.allocs), (unsigned long)(heap.frees));
+
+    return 0;
+}
+
+/*****************************************************************************/
+
+/* Benchmark Functions */
+
+static void run_phase(const bench_phase_t& phase)
+{
+    using namespace std::chrono;
+
+    nanoseconds t_work = nanoseconds(0);
+    Screen.stats_reset();
+    Coalescer.reset();
+    native_i2c_stats_reset();
+
+    for (uint32_t frame = 0U; frame < phase.frames; frame++)
+    {
+        if (phase.touch_script != nullptr)
+        {   phase.touch_script(frame, phase.frames);   }
+        native_time_advance_ms(NATIVE_FRAME_PERIOD_MS);
+
+        steady_clock::time_point t0 = steady_clock::now();
+        manage_uptime();
+        manage_touch();
+        manage_ui();
+        t_work = t_work + (steady_clock::now() - t0);
+    }
+    const LGFX::stats_t& stats = Screen.stats();
+    const AreaCoalescer::stats_t& areas = Coalescer.get_stats();
+    native_i2c_stats_t i2c_stats = native_i2c_stats();
+    uint32_t flushes = stats.addr_windows;
+    double t_work_s = duration<double>(t_work).count();
+    double pixels_per_s = (t_work_s > 0.0) ?
+        (static_cast<double>(stats.pixels_written) / t_work_s) : 0.0;
+    double flushes_per_frame = static_cast<double>(flushes) / phase.frames;
+    double avg_area = (flushes > 0U) ?
+        (static_cast<double>(stats.pixels_written) / flushes) : 0.0;
+
+    printf("\n[Benchmark] Phase: %s (%lu frames)\n", phase.name,
+        (unsigned long)(phase.frames));
+    printf("  Work time: %.3f ms (%.1f us/frame)\n", t_work_s * 1000.0,
+        (t_work_s * 1000000.0) / phase.frames);
+    printf("  Pixels flushed: %llu (%llu converted)\n",
+        (unsigned long long)(stats.pixels_written),
+        (unsigned long long)(stats.pixels_converted));
+    printf("  Pixels rendered per second: %.0f\n", pixels_per_s);
+    printf("  Flush calls per frame: %.2f\n", flushes_per_frame);
+    printf("  Average flushed area: %.0f px\n", avg_area);
+    printf("  Invalidated areas: %lu -> %lu coalesced (%llu -> %llu px)\n",
+        (unsigned long)(areas.areas_in), (unsigned long)(areas.areas_out),
+        (unsigned long long)(areas.px_in), (unsigned long long)(areas.px_out));
+    printf("  I2C transactions: %lu (%lu Bytes read)\n",
+        (unsigned long)(i2c_stats.transactions),
+        (unsigned long)(i2c_stats.bytes_read));
+    printf("  Frame checksum: 0x%08lx\n",
+        (unsigned long)(Screen.frame_checksum()));
+}
+
+/*****************************************************************************/
+
+/* Benchmark Functions - Areas Coalescing Replay */
+
+static void run_areas_replay()
+{
+    AreaCoalescer coalescer(0U);
+
+    printf("\n[Benchmark] Invalidated areas coalescing replay\n");
+    for (const bench_areas_t& pattern : BENCH_AREAS)
+    {
+        for (uint32_t window_cost_px : BENCH_WINDOW_COSTS_PX)
+        {
+            lv_area_t areas[4];
+            uint8_t joined[4] = {0U};
+
+            memcpy(areas, pattern.areas, sizeof(areas));
+            coalescer.set_window_cost(window_cost_px);
+            coalescer.reset();
+            coalescer.coalesce(areas, joined, pattern.num_areas);
+
+            // Modeled bus cost (pixels + address windows) before and after
+            const AreaCoalescer::stats_t& stats = coalescer.get_stats();
+            uint64_t cost_in = stats.px_in +
+                ((uint64_t)(stats.areas_in) * window_cost_px);
+            uint64_t cost_out = stats.px_out +
+                ((uint64_t)(stats.areas_out) * window_cost_px);
+            printf("  %-16s window cost %4lu px: areas %lu -> %lu, "
+                "pixels %llu -> %llu, bus cost %llu -> %llu px\n",
+                pattern.name, (unsigned long)(window_cost_px),
+                (unsigned long)(stats.areas_in),
+                (unsigned long)(stats.areas_out),
+                (unsigned long long)(stats.px_in),
+                (unsigned long long)(stats.px_out),
+                (unsigned long long)(cost_in), (unsigned long long)(cost_out));
+        }
+    }
+}
+
+/*****************************************************************************/
+
+
+/* Benchmark Functions - Touch Panel */
+
+/**
+ * @details Reports the time of a touch sample read for each I2C frequency,
+ * and the frequency probed at touch_init().
+ */
+static void run_touch_speeds()
+{
+    uint8_t regs[BENCH_TOUCH_SAMPLE_NUM_REGS];
+
+    printf("\n[Benchmark] Touch I2C frequency probed: %lu Hz\n",
+        (unsigned long)(TouchI2C::get_frequency()));
+    native_touch_press(NATIVE_BUTTON_X, NATIVE_BUTTON_Y);
+    for (uint32_t frequency : BENCH_I2C_FREQUENCIES_HZ)
+    {
+        // Touch sample registers read at the frequency of the request
+        i2c_device_t device = { FT6236<TouchI2C>::I2C_ADDRESS,
+            I2C_PRIORITY_TOUCH, ns_const::TOUCH_I2C_DEADLINE_MS, frequency };
+        int64_t t0 = esp_timer_get_time();
+        for (uint32_t i = 0U; i < BENCH_TOUCH_SPEED_SAMPLES; i++)
+        {
+            I2CBus.read_registers_sync(device, BENCH_TOUCH_REG_TD_STATUS,
+                regs, BENCH_TOUCH_SAMPLE_NUM_REGS);
+        }
+        uint32_t read_us = (uint32_t)((esp_timer_get_time() - t0) /
+            BENCH_TOUCH_SPEED_SAMPLES);
+        printf("  %7lu Hz: %4lu us/read\n", (unsigned long)(frequency),
+            (unsigned long)(read_us));
+    }
+    native_touch_release();
+}
+
+/**
+ * @details Time per decoded sample of the shared FT6236 driver on the
+ * mocked device, with compile-time (inlined) and function pointer I2C
+ * transport dispatch.
+ */
+static void run_touch_dispatch()
+{
+    using namespace std::chrono;
+
+    FT6236<MockI2C> MockPanel;
+    FT6236<bench_callback_i2c_t> CallbackPanel;
+    int pos[2];
+
+    MockI2C::reset(FT6236<MockI2C>::I2C_ADDRESS);
+    MockI2C::regs[0x02U] = 0x01U;
+    MockI2C::regs[0x03U] = 0x81U;
+    MockI2C::regs[0x04U] = 0x23U;
+    MockI2C::regs[0x05U] = 0x01U;
+    MockI2C::regs[0x06U] = 0x40U;
+
+    int sum_inline = 0;
+    steady_clock::time_point t0 = steady_clock::now();
+    for (uint32_t i = 0U; i < BENCH_TOUCH_DISPATCH_SAMPLES; i++)
+    {
+        MockPanel.get_position(pos);
+        sum_inline = sum_inline + pos[0];
+    }
+    double t_inline_s = duration<double>(steady_clock::now() - t0).count();
+    int sum_callback = 0;
+    t0 = steady_clock::now();
+    for (uint32_t i = 0U; i < BENCH_TOUCH_DISPATCH_SAMPLES; i++)
+    {
+        CallbackPanel.get_position(pos);
+        sum_callback = sum_callback + pos[0];
+    }
+    double t_callback_s =
+        duration<double>(steady_clock::now() - t0).count();
+
+    printf("\n[Benchmark] Touch driver dispatch: %.1f ns/sample inlined, "
+        "%.1f ns/sample function pointer (%s)\n",
+        (t_inline_s * 1e9) / BENCH_TOUCH_DISPATCH_SAMPLES,
+        (t_callback_s * 1e9) / BENCH_TOUCH_DISPATCH_SAMPLES,
+        (sum_inline == sum_callback) ? "same samples" : "samples differ");
+}
+
+/*****************************************************************************/
+
+/* Benchmark Functions - LVGL Allocations Trace Replay */
+
+/**
+ * @details Replays the LVGL allocations of the UI run on the previous heap
+ * allocator (all blocks in one 8-bit capable heap) and on a new tiered
+ * allocator, comparing their time per operation, and reports where the
+ * blocks of the tiered one went.
+ */
+static void run_alloc_trace_replay()
+{
+    static const native_allocator_t HEAP_ALLOCATOR =
+    {
+        "heap (8-bit caps)",
+        [](size_t size) { return heap_caps_malloc(size, MALLOC_CAP_8BIT); },
+        [](void* ptr, size_t size)
+        {   return heap_caps_realloc(ptr, size, MALLOC_CAP_8BIT);   },
+        [](void* ptr) { heap_caps_free(ptr); }
+    };
+    static const native_allocator_t TIERED_ALLOCATOR =
+    {
+        "tiered",
+        [](size_t size) { return ReplayAllocator.malloc(size); },
+        [](void* ptr, size_t size)
+        {   return ReplayAllocator.realloc(ptr, size);   },
+        [](void* ptr) { ReplayAllocator.free(ptr); }
+    };
+    double t_heap_s = 0.0;
+    double t_tiered_s = 0.0;
+
+    printf("\n[Benchmark] LVGL allocations trace replay: %lu allocs, "
+        "%lu reallocs, %lu frees\n",
+        (unsigned long)(native_alloc_trace_count(TieredAllocator::TRACE_ALLOC)),
+        (unsigned long)(native_alloc_trace_count(
+            TieredAllocator::TRACE_REALLOC)),
+        (unsigned long)(native_alloc_trace_count(TieredAllocator::TRACE_FREE)));
+
+    ReplayAllocator.init();
+    native_alloc_trace_replay(HEAP_ALLOCATOR, false, t_heap_s);
+    ReplayAllocator.reset_stats();
+    native_alloc_trace_replay(TIERED_ALLOCATOR, false, t_tiered_s);
+
+    double num_ops_total = (double)(native_alloc_trace_size());
+    if (num_ops_total > 0.0)
+    {
+        printf("  %-18s %.1f ns/op\n", HEAP_ALLOCATOR.name,
+            (t_heap_s * 1e9) / num_ops_total);
+        printf("  %-18s %.1f ns/op\n", TIERED_ALLOCATOR.name,
+            (t_tiered_s * 1e9) / num_ops_total);
+    }
+    ReplayAllocator.dump();
+}
+
+/*****************************************************************************/
+
+/* Benchmark Functions - Image Cache */
+
+/**
+ * @details Redraws a row of icons (each source shown by several objects)
+ * without cache (no budget, only the last decoded image is kept) and with
+ * budget for all of them, reporting the time per frame of each.
+ */
+static void run_image_cache()
+{
+    static uint8_t icon_data[(BENCH_IMG_ICON_PX * BENCH_IMG_ICON_PX) / 2];
+    lv_img_dsc_t icons[BENCH_IMG_SOURCES];
+
+    for (size_t i = 0U; i < sizeof(icon_data); i++)
+    {   icon_data[i] = (uint8_t)(i * 37U);   }
+    for (lv_img_dsc_t& icon : icons)
+    {
+        memset(&icon, 0, sizeof(lv_img_dsc_t));
+        icon.header.cf = LV_IMG_CF_ALPHA_4BIT;
+        icon.header.w = BENCH_IMG_ICON_PX;
+        icon.header.h = BENCH_IMG_ICON_PX;
+        icon.data_size = sizeof(icon_data);
+        icon.data = icon_data;
+    }
+
+    // Row of icons, grouped by source
+    lv_obj_t* row = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(row);
+    lv_obj_set_size(row, BENCH_IMG_SOURCES * BENCH_IMG_COPIES *
+        BENCH_IMG_ICON_PX, BENCH_IMG_ICON_PX);
+    lv_obj_set_pos(row, 0, 0);
+    for (uint8_t i = 0U; i < BENCH_IMG_SOURCES * BENCH_IMG_COPIES; i++)
+    {
+        lv_obj_t* img = lv_img_create(row);
+        lv_img_set_src(img, &icons[i / BENCH_IMG_COPIES]);
+        lv_obj_set_pos(img, i * BENCH_IMG_ICON_PX, 0);
+    }
+    size_t icon_bytes = (size_t)(BENCH_IMG_ICON_PX) * BENCH_IMG_ICON_PX *
+        LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+    // No budget
+    ImgCache.invalidate(nullptr);
+    ImgCache.set_budget(0U);
+    ImgCache.reset_stats();
+    double t_uncached_s = image_cache_redraw(row, BENCH_IMG_FRAMES);
+    ImageCache::stats_t uncached = ImgCache.get_stats();
+
+    // Budget for all the icons
+    ImgCache.set_budget(BENCH_IMG_SOURCES * icon_bytes);
+    ImgCache.invalidate(nullptr);
+    ImgCache.reset_stats();
+    double t_cached_s = image_cache_redraw(row, BENCH_IMG_FRAMES);
+    ImageCache::stats_t cached = ImgCache.get_stats();
+
+    ImgCache.invalidate(nullptr);
+    ImgCache.set_budget(ns_const::SCREEN_IMG_CACHE_BUDGET_BYTES);
+    ImgCache.reset_stats();
+    lv_obj_del(row);
+    lv_refr_now(NULL);
+    display_flush_wait_all();
+
+    printf("\n[Benchmark] Image cache, %u icons shown %u times, %lu frames:\n",
+        (unsigned)(BENCH_IMG_SOURCES), (unsigned)(BENCH_IMG_COPIES),
+        (unsigned long)(BENCH_IMG_FRAMES));
+    printf("  no budget:  %5lu misses, %5lu hits, %7.1f us/frame\n",
+        (unsigned long)(uncached.misses), (unsigned long)(uncached.hits),
+        (t_uncached_s * 1e6) / BENCH_IMG_FRAMES);
+    printf("  all icons:  %5lu misses, %5lu hits, %7.1f us/frame\n",
+        (unsigned long)(cached.misses), (unsigned long)(cached.hits),
+        (t_cached_s * 1e6) / BENCH_IMG_FRAMES);
+}
+
+/**
+ * @details Returns the time spent (s) redrawing the object the frames.
+ */
+static double image_cache_redraw(lv_obj_t* obj, const uint32_t frames)
+{
+    using namespace std::chrono;
+
+    steady_clock::time_point t0 = steady_clock::now();
+    for (uint32_t frame = 0U; frame < frames; frame++)
+    {
+        lv_obj_invalidate(obj);
+        lv_refr_now(NULL);
+    }
+    display_flush_wait_all();
+    return duration<double>(steady_clock::now() - t0).count();
+}
+
+/*****************************************************************************/
+
+/* Unit Tests Build Guard Close */
+
+#endif /* !defined(PIO_UNIT_TESTING) */
@@ -0,0 +1,135 @@
+/**
+ * @file    i2c.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build stand-in of ESP-IDF I2C driver header.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef NATIVE_DRIVER_I2C_H
+#define NATIVE_DRIVER_I2C_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C Libraries
+#include <stdbool.h>
+#include <stddef.h>
+
+// ESP-IDF Stand-in
+#include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+
+/*****************************************************************************/
+
+/* Defines */
+
+#define I2C_SCLK_SRC_FLAG_FOR_NOMAL 0
+
+// Command Link buffer size for a number of read/write transactions
+#define I2C_INTERNAL_STRUCT_SIZE (24)
+#define I2C_LINK_RECOMMENDED_SIZE(TRANSACTIONS) \
+    (2 * I2C_INTERNAL_STRUCT_SIZE + I2C_INTERNAL_STRUCT_SIZE * \
+    (5 * (TRANSACTIONS)))
+
+/*****************************************************************************/
+
+/* Data Types */
+
+typedef enum { I2C_NUM_0 = 0, I2C_NUM_1, I2C_NUM_MAX } i2c_port_t;
+typedef enum { I2C_MODE_SLAVE = 0, I2C_MODE_MASTER } i2c_mode_t;
+typedef enum { I2C_MASTER_WRITE = 0, I2C_MASTER_READ } i2c_rw_t;
+typedef enum
+{
+    I2C_MASTER_ACK = 0,
+    I2C_MASTER_NACK,
+    I2C_MASTER_LAST_NACK
+} i2c_ack_type_t;
+
+typedef struct
+{
+    i2c_mode_t mode;
+    int sda_io_num;
+    int scl_io_num;
+    bool sda_pullup_en;
+    bool scl_pullup_en;
+    struct
+    {   uint32_t clk_speed;   } master;
+    uint32_t clk_flags;
+} i2c_config_t;
+
+typedef void* i2c_cmd_handle_t;
+
+/*****************************************************************************/
+
+/* Functions */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+esp_err_t i2c_param_config(i2c_port_t i2c_num, const i2c_config_t* config);
+esp_err_t i2c_driver_install(i2c_port_t i2c_num, i2c_mode_t mode,
+    size_t slv_rx_buf_len, size_t slv_tx_buf_len, int intr_alloc_flags);
+esp_err_t i2c_driver_delete(i2c_port_t i2c_num);
+i2c_cmd_handle_t i2c_cmd_link_create(void);
+i2c_cmd_handle_t i2c_cmd_link_create_static(uint8_t* buffer, uint32_t size);
+void i2c_cmd_link_delete(i2c_cmd_handle_t cmd_handle);
+void i2c_cmd_link_delete_static(i2c_cmd_handle_t cmd_handle);
+esp_err_t i2c_master_start(i2c_cmd_handle_t cmd_handle);
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd_handle, uint8_t data,
+    bool ack_en);
+esp_err_t i2c_master_read_byte(i2c_cmd_handle_t cmd_handle, uint8_t* data,
+    i2c_ack_type_t ack);
+esp_err_t i2c_master_read(i2c_cmd_handle_t cmd_handle, uint8_t* data,
+    size_t data_len, i2c_ack_type_t ack);
+esp_err_t i2c_master_stop(i2c_cmd_handle_t cmd_handle);
+esp_err_t i2c_master_cmd_begin(i2c_port_t i2c_num, i2c_cmd_handle_t cmd_handle,
+    TickType_t ticks_to_wait);
+esp_err_t i2c_master_write_to_device(i2c_port_t i2c_num, uint8_t device_address,
+    const uint8_t* write_buffer, size_t write_size, TickType_t ticks_to_wait);
+esp_err_t i2c_master_write_read_device(i2c_port_t i2c_num,
+    uint8_t device_address, const uint8_t* write_buffer, size_t write_size,
+    uint8_t* read_buffer, size_t read_size, TickType_t ticks_to_wait);
+
+#ifdef __cplusplus
+}
+#endif
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* NATIVE_DRIVER_I2C_H */
@@ -0,0 +1,85 @@
+/**
+ * @file    esp_intr_alloc.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build stand-in of ESP-IDF interrupt allocation header.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef NATIVE_ESP_INTR_ALLOC_H
+#define NATIVE_ESP_INTR_ALLOC_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// ESP-IDF Framework
+#include "esp_err.h"
+
+/*****************************************************************************/
+
+/* Defines */
+
+#define ESP_INTR_FLAG_LOWMED ((1 << 1) | (1 << 2) | (1 << 3))
+#define ESP_INTR_FLAG_SHARED (1 << 8)
+#define ESP_INTR_FLAG_IRAM   (1 << 10)
+
+/*****************************************************************************/
+
+/* Data Types */
+
+typedef void (*intr_handler_t)(void* arg);
+typedef void* intr_handle_t;
+
+/*****************************************************************************/
+
+/* Functions */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The handler runs in place when the test raises the interrupt source
+esp_err_t esp_intr_alloc(int source, int flags, intr_handler_t handler,
+    void* arg, intr_handle_t* ret_handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* NATIVE_ESP_INTR_ALLOC_H */
@@ -1,18 +1,18 @@
 /**
- * @file    driver_ft6236.h
+ * @file    esp_psram.h
  * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
- * @date    2024-12-27
+ * @date    2026-10-16
  * @version 1.0.0
  *
  * @section DESCRIPTION
  *
- * FT6236 Touch panel I2C controller driver.
+ * Native (host) build stand-in of ESP-IDF PSRAM header.
  *
  * @section LICENSE
  *
  * MIT License
  *
- * Copyright (c) 2024 Jose Miguel Rios Rubio
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
  *
  * Permission is hereby granted, free of charge, to any person obtaining a
  * copy of this software and associated documentation files (the "Software"),
@@ -37,25 +37,32 @@
 
 /* Include Guard */
 
-#ifndef DRIVER_FT6236_H
-#define DRIVER_FT6236_H
+#ifndef NATIVE_ESP_PSRAM_H
+#define NATIVE_ESP_PSRAM_H
 
 /*****************************************************************************/
 
 /* Libraries */
 
-// I2C Driver
-#include <Wire.h>
+// Standard C Libraries
+#include <stddef.h>
 
 /*****************************************************************************/
 
 /* Functions */
 
-int touch_panel_init(const uint8_t pin_i2c_sda, const uint8_t pin_i2c_scl);
-void touch_panel_get_position(int pos[2]);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+size_t esp_psram_get_size(void);
+
+#ifdef __cplusplus
+}
+#endif
 
 /*****************************************************************************/
 
 /* Include Guard Close */
 
-#endif /* DRIVER_FT6236_H */
+#endif /* NATIVE_ESP_PSRAM_H */
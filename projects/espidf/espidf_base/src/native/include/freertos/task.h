@@ -0,0 +1,101 @@
+/**
+ * @file    task.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build stand-in of FreeRTOS task header.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef NATIVE_FREERTOS_TASK_H
+#define NATIVE_FREERTOS_TASK_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+#include "freertos/FreeRTOS.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+/*****************************************************************************/
+
+/* Macros */
+
+// There are no other tasks to yield to
+#define taskYIELD()
+
+/*****************************************************************************/
+
+/* Functions */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Tasks are not run in the native build, creation fails unless the task
+// name was enabled with native_task_enable() (the test then runs the task
+// steps itself after native_task_switch())
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task_code,
+    const char* name, const uint32_t stack_depth, void* parameters,
+    UBaseType_t priority, TaskHandle_t* created_task, const BaseType_t core);
+
+// Advances the native simulated clock instead of sleeping
+void vTaskDelay(const TickType_t ticks);
+
+// Task notifications (counted per enabled task, the take is done by the
+// task set by native_task_switch() and advances the clock on timeout)
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task,
+    BaseType_t* higher_priority_task_woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait);
+
+// Running task set by native_task_switch() (null for main), tasks are
+// not deleted
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+void vTaskDelete(TaskHandle_t task);
+
+#ifdef __cplusplus
+}
+#endif
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* NATIVE_FREERTOS_TASK_H */
@@ -0,0 +1,104 @@
+/**
+ * @file    lcd_ll.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build stand-in of ESP-IDF LCD_CAM low level header.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef NATIVE_HAL_LCD_LL_H
+#define NATIVE_HAL_LCD_LL_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C Libraries
+#include <stdbool.h>
+#include <stdint.h>
+
+/*****************************************************************************/
+
+/* Defines */
+
+#define LCD_LL_EVENT_VSYNC_END  (1 << 0)
+#define LCD_LL_EVENT_TRANS_DONE (1 << 1)
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// LCD_CAM peripheral interrupt registers
+typedef struct
+{
+    uint32_t int_ena;
+    uint32_t int_raw;
+} lcd_cam_dev_t;
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+// LCD_CAM peripheral (native/native_platform.cpp)
+extern lcd_cam_dev_t LCD_CAM;
+
+/*****************************************************************************/
+
+/* Functions */
+
+static inline void lcd_ll_enable_interrupt(lcd_cam_dev_t* dev,
+    uint32_t mask, bool en)
+{
+    if (en)
+    {   dev->int_ena = dev->int_ena | (mask & 0x03U);   }
+    else
+    {   dev->int_ena = dev->int_ena & ~(mask & 0x03U);   }
+}
+
+static inline uint32_t lcd_ll_get_interrupt_status(lcd_cam_dev_t* dev)
+{
+    return (dev->int_raw & dev->int_ena);
+}
+
+static inline void lcd_ll_clear_interrupt_status(lcd_cam_dev_t* dev,
+    uint32_t mask)
+{
+    dev->int_raw = dev->int_raw & ~(mask & 0x03U);
+}
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* NATIVE_HAL_LCD_LL_H */
@@ -0,0 +1,277 @@
+/**
+ * @file    lgfx_native.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build memory-backed stand-in of the LovyanGFX LGFX screen.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef NATIVE_LGFX_NATIVE_H
+#define NATIVE_LGFX_NATIVE_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstdint>
+#include <cstring>
+
+// ESP-IDF Stand-in
+#include "esp_timer.h"
+
+// Project Headers
+#include "native/native.h"
+
+/*****************************************************************************/
+
+/* Defines */
+
+#define TFT_BLACK 0x0000U
+
+/*****************************************************************************/
+
+/* Data Types */
+
+namespace lgfx
+{
+    // RGB565 in CPU (little-endian) byte order
+    struct rgb565_t
+    {   uint16_t raw;   };
+
+    // RGB565 in panel bus (big-endian) byte order
+    struct swap565_t
+    {   uint16_t raw;   };
+}
+
+/*****************************************************************************/
+
+/* Screen Stand-in */
+
+class LGFX
+{
+    public:
+
+        /**
+         * @brief Bus transfers statistics.
+         */
+        struct stats_t
+        {
+            uint32_t addr_windows;
+            uint32_t write_calls;
+            uint32_t dma_write_calls;
+            uint64_t pixels_written;
+            uint64_t pixels_converted;
+        };
+
+        /**
+         * @brief DMA transfer start and end time (simulated clock).
+         */
+        struct dma_transfer_t
+        {
+            int64_t start_us;
+            int64_t end_us;
+        };
+
+        static constexpr uint16_t WIDTH = 480U;
+        static constexpr uint16_t HEIGHT = 320U;
+
+        // Modeled bus rate of DMA transfers (16-bit parallel bus, one
+        // pixel per write cycle)
+        static constexpr uint32_t DMA_PIXELS_PER_S = 20000000U;
+
+        bool begin()
+        {
+            stats_reset();
+            return true;
+        }
+
+        void setRotation(const uint8_t rotation)
+        {   _rotation = rotation;   }
+
+        void fillScreen(const uint16_t color)
+        {
+            for (uint32_t i = 0U; i < (uint32_t)(WIDTH) * HEIGHT; i++)
+            {   _frame[i] = swap_bytes(color);   }
+        }
+
+        void startWrite()
+        {   _start_count = _start_count + 1U;   }
+
+        void endWrite()
+        {
+            if (_start_count > 0U)
+            {   _start_count = _start_count - 1U;   }
+        }
+
+        uint32_t getStartCount()
+        {   return _start_count;   }
+
+        void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h)
+        {
+            _win_x = x;
+            _win_y = y;
+            _win_w = w;
+            _win_h = h;
+            _win_pos = 0U;
+            _stats.addr_windows = _stats.addr_windows + 1U;
+        }
+
+        template <typename T>
+        void writePixels(const T* data, int32_t len)
+        {
+            write_to_frame(data, len);
+            _stats.write_calls = _stats.write_calls + 1U;
+        }
+
+        /**
+         * @details The pixels reach the frame memory at once, but the
+         * transfer keeps the bus busy for its modeled time on the simulated
+         * clock. A new transfer waits for the previous one to end.
+         */
+        template <typename T>
+        void writePixelsDMA(const T* data, int32_t len)
+        {
+            waitDMA();
+            write_to_frame(data, len);
+            _dma.start_us = esp_timer_get_time();
+            _dma.end_us = _dma.start_us +
+                (((int64_t)(len) * 1000000LL) + DMA_PIXELS_PER_S - 1) /
+                DMA_PIXELS_PER_S;
+            _stats.dma_write_calls = _stats.dma_write_calls + 1U;
+        }
+
+        /**
+         * @details Rendering takes no time on the simulated clock, so a
+         * poll that finds the transfer in progress stands for the time
+         * spent polling until it ends (the simulated clock is advanced to
+         * the transfer end, and the next poll finds it done).
+         */
+        bool dmaBusy()
+        {
+            int64_t now_us = esp_timer_get_time();
+            if (now_us >= _dma.end_us)
+            {   return false;   }
+            native_time_advance_us((uint32_t)(_dma.end_us - now_us));
+            return true;
+        }
+
+        void waitDMA()
+        {
+            int64_t now_us = esp_timer_get_time();
+            if (now_us < _dma.end_us)
+            {   native_time_advance_us((uint32_t)(_dma.end_us - now_us));   }
+        }
+
+        /**
+         * @brief Get the start and end time of the last DMA transfer.
+         */
+        const dma_transfer_t& dma_last()
+        {   return _dma;   }
+
+        /**
+         * @brief Get the frame memory, with pixels in panel bus byte order.
+         */
+        const uint16_t* frame()
+        {   return _frame;   }
+
+        /**
+         * @brief Get a FNV-1a hash of the frame memory to compare the
+         * rendered output between builds.
+         */
+        uint32_t frame_checksum()
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(_frame);
+            uint32_t hash = 2166136261U;
+            for (uint32_t i = 0U; i < sizeof(_frame); i++)
+            {   hash = (hash ^ bytes[i]) * 16777619U;   }
+            return hash;
+        }
+
+        const stats_t& stats()
+        {   return _stats;   }
+
+        void stats_reset()
+        {   memset(&_stats, 0, sizeof(_stats));   }
+
+    /******************************************************************/
+
+    private:
+
+        uint16_t _frame[WIDTH * HEIGHT] = {0};
+        stats_t _stats = {0U, 0U, 0U, 0U, 0U};
+        dma_transfer_t _dma = {0, 0};
+        uint8_t _rotation = 0U;
+        uint32_t _start_count = 0U;
+        int32_t _win_x = 0;
+        int32_t _win_y = 0;
+        int32_t _win_w = 0;
+        int32_t _win_h = 0;
+        uint32_t _win_pos = 0U;
+
+        static uint16_t swap_bytes(const uint16_t color)
+        {   return (uint16_t)((color << 8) | (color >> 8));   }
+
+        // Pixels already in bus byte order are sent as they are
+        static uint16_t to_bus(const lgfx::swap565_t& pixel)
+        {   return pixel.raw;   }
+
+        // Pixels in CPU byte order need a conversion (like LovyanGFX does)
+        uint16_t to_bus(const lgfx::rgb565_t& pixel)
+        {
+            _stats.pixels_converted = _stats.pixels_converted + 1U;
+            return swap_bytes(pixel.raw);
+        }
+
+        template <typename T>
+        void write_to_frame(const T* data, int32_t len)
+        {
+            for (int32_t i = 0; i < len; i++)
+            {
+                int32_t x = _win_x + (int32_t)(_win_pos % _win_w);
+                int32_t y = _win_y + (int32_t)(_win_pos / _win_w);
+                uint16_t pixel = to_bus(data[i]);
+                if ( (x >= 0) && (x < WIDTH) && (y >= 0) && (y < HEIGHT) )
+                {   _frame[(y * WIDTH) + x] = pixel;   }
+                _win_pos = _win_pos + 1U;
+            }
+            _stats.pixels_written = _stats.pixels_written + len;
+        }
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* NATIVE_LGFX_NATIVE_H */
@@ -0,0 +1,161 @@
+/**
+ * @file    native.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build platform simulation controls.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef NATIVE_NATIVE_H
+#define NATIVE_NATIVE_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Native I2C bus statistics.
+ */
+struct native_i2c_stats_t
+{
+    uint32_t transactions;
+    uint32_t bytes_read;
+    uint64_t bus_us;
+};
+
+/**
+ * @brief Native I2C simulated faults of the FT6236 touch panel.
+ */
+enum native_i2c_fault_t
+{
+    NATIVE_I2C_FAULT_NONE = 0,
+    NATIVE_I2C_FAULT_NACK,
+    NATIVE_I2C_FAULT_STUCK_SDA
+};
+
+/**
+ * @brief Native PWM channel state, with the simulated clock time of its
+ * last output edges (duty set to non zero and set to zero) and the number
+ * of times it was switched on.
+ */
+struct native_pwm_state_t
+{
+    uint32_t frequency;
+    uint32_t duty;
+    int64_t on_us;
+    int64_t off_us;
+    uint32_t on_edges;
+};
+
+/**
+ * @brief Native LEDC driver statistics: full timer configurations and
+ * timer frequency changes (ledc_set_freq()).
+ */
+struct native_ledc_stats_t
+{
+    uint32_t timer_configs;
+    uint32_t freq_changes;
+};
+
+/**
+ * @brief Native heap usage statistics.
+ */
+struct native_heap_stats_t
+{
+    size_t used;
+    size_t peak;
+    uint32_t allocs;
+    uint32_t frees;
+};
+
+/*****************************************************************************/
+
+/* Functions */
+
+// Simulated Clock
+void native_time_advance_ms(const uint32_t ms);
+void native_time_advance_us(const uint32_t us);
+
+// Heap Statistics
+native_heap_stats_t native_heap_stats();
+
+// Heap Free Memory Limit (PSRAM if caps has MALLOC_CAP_SPIRAM, otherwise
+// internal RAM), allocations that don't fit fail (SIZE_MAX, no limit)
+void native_heap_set_free(const uint32_t caps, const size_t free_bytes);
+
+// Tasks (a task is created only if its name was enabled before, the test
+// switches to its handle to run the task steps, null handle for main)
+void native_task_enable(const char* name);
+void native_task_switch(void* task);
+uint32_t native_task_notifications(void* task);
+
+// GPIO Inputs (level driven from outside, fires the configured interrupt)
+void native_gpio_input(const int gpio_num, const uint32_t level);
+
+// LCD_CAM transfer done event (fires its interrupt if enabled)
+void native_lcd_trans_done();
+
+// I2C Bus Statistics
+native_i2c_stats_t native_i2c_stats();
+void native_i2c_stats_reset();
+
+// I2C Simulated Faults (and I2C driver install failures)
+void native_i2c_set_fault(const native_i2c_fault_t fault);
+void native_i2c_set_install_fail(const bool fail);
+
+// I2C Bus Lines (for the GPIO stand-in, -1 if not an I2C bus pin)
+int native_i2c_gpio_get_level(const int gpio_num);
+void native_i2c_gpio_set_level(const int gpio_num, const uint32_t level);
+
+// PWM Channels State and LEDC Driver Statistics
+native_pwm_state_t native_pwm_state(const uint8_t chan);
+native_ledc_stats_t native_ledc_stats();
+
+// Simulated FT6236 Touch Panel (screen coordinates)
+void native_touch_press(const uint16_t x, const uint16_t y);
+void native_touch_release();
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* NATIVE_NATIVE_H */
@@ -0,0 +1,191 @@
+/**
+ * @file    native_alloc_trace.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build record of the LVGL allocations, and its replay on
+ * other allocators.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "native_alloc_trace.h"
+
+// Standard C++ Libraries
+#include <chrono>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Recorded LVGL allocation operation (blocks identified by the order
+ * of their allocation, 0 for none).
+ */
+struct alloc_op_t
+{
+    TieredAllocator::trace_op_t op;
+    uint32_t id;
+    uint32_t old_id;
+    uint32_t size;
+};
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// Recorded allocations trace, and identifiers of its live blocks
+static std::vector<alloc_op_t> alloc_trace;
+static std::unordered_map<const void*, uint32_t> alloc_trace_ids;
+static uint32_t alloc_trace_blocks = 0U;
+
+/*****************************************************************************/
+
+/* Functions */
+
+void native_alloc_trace_record(const TieredAllocator::trace_op_t op,
+    const void* ptr, const void* old_ptr, const size_t size)
+{
+    alloc_op_t alloc_op = { op, 0U, 0U, (uint32_t)(size) };
+
+    if (old_ptr != nullptr)
+    {
+        auto block = alloc_trace_ids.find(old_ptr);
+        if (block == alloc_trace_ids.end())
+        {   return;   }
+        alloc_op.old_id = block->second;
+        alloc_trace_ids.erase(block);
+    }
+    if (ptr != nullptr)
+    {
+        alloc_trace_blocks = alloc_trace_blocks + 1U;
+        alloc_op.id = alloc_trace_blocks;
+        alloc_trace_ids[ptr] = alloc_op.id;
+    }
+    alloc_trace.push_back(alloc_op);
+}
+
+uint32_t native_alloc_trace_count(const TieredAllocator::trace_op_t op)
+{
+    uint32_t count = 0U;
+
+    for (const alloc_op_t& alloc_op : alloc_trace)
+    {
+        if (alloc_op.op == op)
+        {   count = count + 1U;   }
+    }
+    return count;
+}
+
+size_t native_alloc_trace_size()
+{
+    return alloc_trace.size();
+}
+
+bool native_alloc_trace_replay(const native_allocator_t& allocator,
+    const bool verify, double& t_replay_s)
+{
+    using namespace std::chrono;
+
+    std::vector<uint8_t*> blocks(alloc_trace_blocks + 1U, nullptr);
+    std::vector<uint32_t> sizes(alloc_trace_blocks + 1U, 0U);
+    bool ok = true;
+
+    auto block_check = [&](const uint32_t id, const uint32_t size)
+    {
+        for (uint32_t i = 0U; verify && (i < size); i++)
+        {
+            if (blocks[id][i] != (uint8_t)(id))
+            {   return false;   }
+        }
+        return true;
+    };
+
+    steady_clock::time_point t0 = steady_clock::now();
+    for (const alloc_op_t& alloc_op : alloc_trace)
+    {
+        void* ptr = nullptr;
+        uint32_t kept_size = 0U;
+        if (alloc_op.op == TieredAllocator::TRACE_ALLOC)
+        {   ptr = allocator.malloc(alloc_op.size);   }
+        else if (alloc_op.op == TieredAllocator::TRACE_REALLOC)
+        {
+            kept_size = (sizes[alloc_op.old_id] < alloc_op.size) ?
+                sizes[alloc_op.old_id] : alloc_op.size;
+            ptr = allocator.realloc(blocks[alloc_op.old_id], alloc_op.size);
+            if (ptr != nullptr)
+            {   blocks[alloc_op.old_id] = nullptr;   }
+        }
+        else
+        {
+            ok = block_check(alloc_op.old_id, sizes[alloc_op.old_id]) && ok;
+            allocator.free(blocks[alloc_op.old_id]);
+            blocks[alloc_op.old_id] = nullptr;
+        }
+
+        if (alloc_op.id == 0U)
+        {   continue;   }
+        if (ptr == nullptr)
+        {
+            ok = false;
+            continue;
+        }
+        blocks[alloc_op.id] = static_cast<uint8_t*>(ptr);
+        sizes[alloc_op.id] = alloc_op.size;
+        if (verify)
+        {
+            // Moved part keeps the pattern of the previous block
+            for (uint32_t i = 0U; i < kept_size; i++)
+            {
+                if (blocks[alloc_op.id][i] != (uint8_t)(alloc_op.old_id))
+                {   ok = false;   }
+            }
+            memset(ptr, (uint8_t)(alloc_op.id), alloc_op.size);
+        }
+    }
+    for (uint32_t id = 1U; id <= alloc_trace_blocks; id++)
+    {
+        if (blocks[id] == nullptr)
+        {   continue;   }
+        ok = block_check(id, sizes[id]) && ok;
+        allocator.free(blocks[id]);
+    }
+    t_replay_s = duration<double>(steady_clock::now() - t0).count();
+
+    return ok;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,110 @@
+/**
+ * @file    native_alloc_trace.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build record of the LVGL allocations, and its replay on
+ * other allocators.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef NATIVE_NATIVE_ALLOC_TRACE_H
+#define NATIVE_NATIVE_ALLOC_TRACE_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+// Project Headers
+#include "memory/tiered_allocator.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Allocator to replay the LVGL allocations trace on.
+ */
+struct native_allocator_t
+{
+    const char* name;
+    void* (*malloc)(size_t size);
+    void* (*realloc)(void* ptr, size_t size);
+    void (*free)(void* ptr);
+};
+
+/*****************************************************************************/
+
+/* Functions */
+
+/**
+ * @brief Record an allocation operation (TieredAllocator trace callback,
+ * see TieredAllocator::set_trace()).
+ */
+void native_alloc_trace_record(const TieredAllocator::trace_op_t op,
+    const void* ptr, const void* old_ptr, const size_t size);
+
+/**
+ * @brief Get the number of recorded operations of a kind.
+ * @param op Operation kind.
+ * @return Number of recorded operations.
+ */
+uint32_t native_alloc_trace_count(const TieredAllocator::trace_op_t op);
+
+/**
+ * @brief Get the number of recorded operations.
+ * @return Number of recorded operations.
+ */
+size_t native_alloc_trace_size();
+
+/**
+ * @brief Replay the recorded operations on an allocator, and free the
+ * blocks still in use at the end.
+ * @param allocator Allocator to replay the trace on.
+ * @param verify Fill each block with a pattern of its identifier and check
+ * it when the block is reallocated (the moved part) or freed.
+ * @param t_replay_s Replay time (s).
+ * @return If all allocations succeeded and no block was corrupted.
+ */
+bool native_alloc_trace_replay(const native_allocator_t& allocator,
+    const bool verify, double& t_replay_s);
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* NATIVE_NATIVE_ALLOC_TRACE_H */
@@ -0,0 +1,77 @@
+/**
+ * @file    native_app.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build application startup and loop, for the benchmark and
+ * the native tests.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "native_app.h"
+
+// ESP-IDF Framework
+#include "controller/i2c/i2c.h"
+
+// Project Headers
+#include "native/native.h"
+
+/*****************************************************************************/
+
+/* Functions */
+
+void native_app_init()
+{
+    rtos_init();
+    i2c_setup(I2C_PORT_TOUCH, IO_I2C_SDA, IO_I2C_SCL,
+        ns_const::I2C_FREQUENCY_HZ);
+    buzzer_init();
+    touch_init();
+    screen_init();
+    display_init();
+    ui_draw_screen_1();
+}
+
+void native_app_run_frames(const uint32_t frames)
+{
+    for (uint32_t frame = 0U; frame < frames; frame++)
+    {
+        native_time_advance_ms(NATIVE_FRAME_PERIOD_MS);
+        manage_uptime();
+        manage_touch();
+        manage_ui();
+    }
+}
+
+/*****************************************************************************/
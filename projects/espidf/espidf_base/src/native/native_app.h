@@ -0,0 +1,171 @@
+/**
+ * @file    native_app.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build access to the application (main.cpp) functions and
+ * global elements, and its startup, for the benchmark and the native tests.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef NATIVE_NATIVE_APP_H
+#define NATIVE_NATIVE_APP_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// FreeRTOS Libraries
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+// Project Headers
+#include "config/config.h"
+#include "config/config_screen.h"
+#include "controller/i2c/i2c_scheduler.h"
+#include "buzzer/driver_passive_buzzer.h"
+#include "display/area_coalescer.h"
+#include "display/image_cache.h"
+#include "memory/tiered_allocator.h"
+#include "profiler/boot_profiler.h"
+#include "profiler/frame_profiler.h"
+#include "touch_panel/driver_ft6236.h"
+#include "touch_panel/touch_i2c.h"
+
+/*****************************************************************************/
+
+/* Constants */
+
+// Simulated time between frames
+static constexpr uint32_t NATIVE_FRAME_PERIOD_MS = LV_DISP_DEF_REFR_PERIOD;
+
+// Buzzer Frequency Slider & Beep Button positions (see ui_draw_screen_1())
+static constexpr uint16_t NATIVE_SLIDER_X_START = 115U;
+static constexpr uint16_t NATIVE_SLIDER_WIDTH = 250U;
+static constexpr uint16_t NATIVE_SLIDER_Y = 200U;
+static constexpr uint16_t NATIVE_BUTTON_X = 240U;
+static constexpr uint16_t NATIVE_BUTTON_Y = 240U;
+
+/*****************************************************************************/
+
+/* Application Functions (main.cpp) */
+
+bool rtos_init();
+bool buzzer_init();
+void touch_init();
+void screen_init();
+void display_init();
+void display_flush_wait_all();
+bool display_set_buffer_strategy(const screen_buffer_strategy_t strategy);
+void display_benchmark();
+uint32_t manage_uptime();
+uint32_t manage_touch();
+uint32_t manage_ui();
+bool touch_read_sample();
+bool touch_task_wait_read(const bool pressed);
+bool buzzer_startup_melody();
+bool buzzer_request_beep_from_isr(const uint16_t frequency,
+    const uint16_t time_ms);
+void ui_draw_screen_1();
+TickType_t ms_to_ticks_ceil(const uint32_t ms);
+
+/*****************************************************************************/
+
+/* Application Global Elements */
+
+// Screen Device (main.cpp)
+extern LGFX Screen;
+
+// Screen Render Buffers Strategy in use (main.cpp)
+extern screen_buffer_strategy_t buffer_strategy;
+
+// Screen Invalidated Areas Coalescer (main.cpp)
+extern AreaCoalescer Coalescer;
+
+// LVGL Decoded Images Cache (main.cpp)
+extern ImageCache ImgCache;
+
+// Frame Profiler (main.cpp)
+extern FrameProfiler Profiler;
+
+// Boot Phases Profiler (main.cpp)
+extern BootProfiler Boot;
+
+// I2C Bus Scheduler (main.cpp)
+extern I2CScheduler I2CBus;
+
+// Buzzer (main.cpp)
+extern PassiveBuzzer Buzzer;
+
+// Touch Samples Queue (main.cpp)
+extern QueueHandle_t touch_queue;
+
+// UI Task (main.cpp)
+extern TaskHandle_t ui_task_handle;
+
+// Touch Task, interrupt mode only (main.cpp)
+extern TaskHandle_t touch_task_handle;
+
+// LVGL Tiered Allocator (memory/lv_allocator.cpp)
+extern TieredAllocator LvglAllocator;
+
+// Touch Panel (main.cpp)
+extern FT6236<TouchI2C> TouchPanel;
+
+/*****************************************************************************/
+
+/* Functions */
+
+/**
+ * @brief Run the application startup as app_main() does (without its
+ * tasks, that never run on the native build): RTOS elements, I2C, buzzer,
+ * touch panel, screen, display and the UI screen.
+ */
+void native_app_init();
+
+/**
+ * @brief Run frames of the application loop, advancing the simulated clock
+ * a frame period before each one.
+ * @param frames Number of frames to run.
+ */
+void native_app_run_frames(const uint32_t frames);
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* NATIVE_NATIVE_APP_H */
@@ -0,0 +1,522 @@
+/**
+ * @file    native_i2c.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build ESP-IDF I2C driver with a simulated FT6236 touch panel.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "native.h"
+
+// ESP-IDF Stand-in
+#include "driver/i2c.h"
+#include "esp_heap_caps.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// Command Link command types
+enum native_i2c_cmd_type_t
+{
+    CMD_START = 0,
+    CMD_WRITE,
+    CMD_READ,
+    CMD_STOP
+};
+
+// Command Link command
+struct native_i2c_cmd_t
+{
+    native_i2c_cmd_type_t type;
+    uint8_t byte;
+    uint8_t* data;
+    size_t length;
+};
+
+// Command Link (header placed at the start of the link buffer, followed by
+// the commands)
+struct native_i2c_cmd_link_t
+{
+    uint16_t capacity;
+    uint16_t count;
+};
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Simulated FT6236 I2C Address
+static constexpr uint16_t FT6236_I2C_ADDRESS = 0x38U;
+
+// Number of simulated FT6236 registers
+static constexpr uint8_t FT6236_NUM_REGS = 0x10U;
+
+// Simulated FT6236 Identification registers (library version, chip
+// selecting, interrupt mode, power mode, firmware version, panel ID,
+// release code version and chip ID) and their first register address
+static constexpr uint8_t FT6236_REG_ID = 0xA1U;
+static constexpr uint8_t FT6236_ID[] =
+    { 0x10U, 0x01U, 0x36U, 0x00U, 0x00U, 0x10U, 0x01U, 0x11U };
+
+// Maximum I2C Clock that the FT6236 supports (datasheet), read bytes get
+// corrupted above it
+static constexpr uint32_t FT6236_MAX_FREQUENCY_HZ = 400000UL;
+
+// FT6236 Touch Point Event Flags (XH register bits 7:6)
+static constexpr uint8_t FT6236_EVENT_CONTACT = 0x80U;
+static constexpr uint8_t FT6236_EVENT_LIFT_UP = 0x40U;
+
+// Screen Width (to map screen coordinates into panel coordinates)
+static constexpr uint16_t SCREEN_WIDTH = 480U;
+
+// Command Link buffer size of i2c_cmd_link_create() (and stack buffer of
+// the write/read device helpers)
+static constexpr size_t CMD_LINK_DYNAMIC_SIZE = I2C_LINK_RECOMMENDED_SIZE(4);
+
+// Bits transferred per byte (8 data + ACK)
+static constexpr uint32_t BITS_PER_BYTE = 9U;
+
+// Clock pulses until a slave that holds SDA low releases it
+static constexpr uint8_t STUCK_SDA_RELEASE_PULSES = 3U;
+
+/*****************************************************************************/
+
+/* In-Scope Functions */
+
+static native_i2c_cmd_t* cmd_link_cmds(native_i2c_cmd_link_t* link);
+static esp_err_t cmd_link_add(i2c_cmd_handle_t cmd_handle,
+    const native_i2c_cmd_t& cmd);
+static esp_err_t cmd_link_add_write(i2c_cmd_handle_t cmd_handle,
+    const uint8_t device_address, const uint8_t* write_buffer,
+    const size_t write_size);
+static uint32_t cmd_link_bytes(native_i2c_cmd_link_t* link);
+static void bus_time_advance(const uint32_t us);
+static uint8_t ft6236_reg_read(const uint8_t reg);
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// I2C Bus Statistics
+static native_i2c_stats_t i2c_stats = {0U, 0U, 0U};
+
+// I2C Bus setup (of last configured port)
+static i2c_config_t bus_config = {};
+
+// Simulated Fault, SDA line held low by the slave, and clock pulses since
+static native_i2c_fault_t fault = NATIVE_I2C_FAULT_NONE;
+static bool sda_stuck = false;
+static uint8_t sda_stuck_pulses = 0U;
+
+// I2C driver installed, and simulated driver install failure
+static bool driver_installed = false;
+static bool install_fail = false;
+
+// Simulated FT6236 Registers
+static uint8_t ft6236_regs[FT6236_NUM_REGS] = { 0x00U, 0x00U, 0x00U,
+    FT6236_EVENT_LIFT_UP };
+
+/*****************************************************************************/
+
+/* Simulation Control Functions */
+
+native_i2c_stats_t native_i2c_stats()
+{
+    return i2c_stats;
+}
+
+void native_i2c_stats_reset()
+{
+    i2c_stats.transactions = 0U;
+    i2c_stats.bytes_read = 0U;
+    i2c_stats.bus_us = 0U;
+}
+
+void native_i2c_set_fault(const native_i2c_fault_t simulated_fault)
+{
+    fault = simulated_fault;
+}
+
+void native_i2c_set_install_fail(const bool fail)
+{
+    install_fail = fail;
+}
+
+int native_i2c_gpio_get_level(const int gpio_num)
+{
+    if (gpio_num == bus_config.sda_io_num)
+    {   return (sda_stuck) ? 0 : 1;   }
+    if (gpio_num == bus_config.scl_io_num)
+    {   return 1;   }
+    return -1;
+}
+
+void native_i2c_gpio_set_level(const int gpio_num, const uint32_t level)
+{
+    // Slave releases SDA after some clock pulses
+    if ( (gpio_num != bus_config.scl_io_num) || (level != 0U) ||
+         (sda_stuck == false) )
+    {   return;   }
+    sda_stuck_pulses = sda_stuck_pulses + 1U;
+    if (sda_stuck_pulses >= STUCK_SDA_RELEASE_PULSES)
+    {   sda_stuck = false;   }
+}
+
+void native_touch_press(const uint16_t x, const uint16_t y)
+{
+    // Panel is rotated respect the screen (see display_manage_touch())
+    uint16_t panel_x = y;
+    uint16_t panel_y = SCREEN_WIDTH - x;
+
+    ft6236_regs[0x02U] = 1U;
+    ft6236_regs[0x03U] = FT6236_EVENT_CONTACT | ((panel_x >> 8) & 0x0FU);
+    ft6236_regs[0x04U] = static_cast<uint8_t>(panel_x & 0xFFU);
+    ft6236_regs[0x05U] = static_cast<uint8_t>((panel_y >> 8) & 0x0FU);
+    ft6236_regs[0x06U] = static_cast<uint8_t>(panel_y & 0xFFU);
+}
+
+void native_touch_release()
+{
+    ft6236_regs[0x02U] = 0U;
+    ft6236_regs[0x03U] = FT6236_EVENT_LIFT_UP;
+}
+
+/*****************************************************************************/
+
+/* ESP-IDF I2C Driver Stand-in Functions */
+
+esp_err_t i2c_param_config(i2c_port_t i2c_num, const i2c_config_t* config)
+{
+    bus_config = *config;
+    return ESP_OK;
+}
+
+esp_err_t i2c_driver_install(i2c_port_t i2c_num, i2c_mode_t mode,
+    size_t slv_rx_buf_len, size_t slv_tx_buf_len, int intr_alloc_flags)
+{
+    if (driver_installed)
+    {   return ESP_ERR_INVALID_STATE;   }
+    if (install_fail)
+    {   return ESP_FAIL;   }
+    driver_installed = true;
+    return ESP_OK;
+}
+
+esp_err_t i2c_driver_delete(i2c_port_t i2c_num)
+{
+    if (driver_installed == false)
+    {   return ESP_ERR_INVALID_STATE;   }
+    driver_installed = false;
+    return ESP_OK;
+}
+
+i2c_cmd_handle_t i2c_cmd_link_create(void)
+{
+    uint8_t* buffer = static_cast<uint8_t*>(heap_caps_malloc(
+        CMD_LINK_DYNAMIC_SIZE, MALLOC_CAP_DEFAULT));
+    if (buffer == nullptr)
+    {   return nullptr;   }
+    return i2c_cmd_link_create_static(buffer, CMD_LINK_DYNAMIC_SIZE);
+}
+
+i2c_cmd_handle_t i2c_cmd_link_create_static(uint8_t* buffer, uint32_t size)
+{
+    if ( (buffer == nullptr) || (size < sizeof(native_i2c_cmd_link_t)) )
+    {   return nullptr;   }
+
+    native_i2c_cmd_link_t* link =
+        reinterpret_cast<native_i2c_cmd_link_t*>(buffer);
+    link->capacity = static_cast<uint16_t>(
+        (size - sizeof(native_i2c_cmd_link_t)) / sizeof(native_i2c_cmd_t));
+    link->count = 0U;
+    return link;
+}
+
+void i2c_cmd_link_delete(i2c_cmd_handle_t cmd_handle)
+{
+    heap_caps_free(cmd_handle);
+}
+
+void i2c_cmd_link_delete_static(i2c_cmd_handle_t cmd_handle)
+{}
+
+esp_err_t i2c_master_start(i2c_cmd_handle_t cmd_handle)
+{
+    return cmd_link_add(cmd_handle, { CMD_START, 0U, nullptr, 0U });
+}
+
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd_handle, uint8_t data,
+    bool ack_en)
+{
+    return cmd_link_add(cmd_handle, { CMD_WRITE, data, nullptr, 1U });
+}
+
+esp_err_t i2c_master_read_byte(i2c_cmd_handle_t cmd_handle, uint8_t* data,
+    i2c_ack_type_t ack)
+{
+    return cmd_link_add(cmd_handle, { CMD_READ, 0U, data, 1U });
+}
+
+esp_err_t i2c_master_read(i2c_cmd_handle_t cmd_handle, uint8_t* data,
+    size_t data_len, i2c_ack_type_t ack)
+{
+    if (data_len == 0U)
+    {   return ESP_ERR_INVALID_ARG;   }
+    return cmd_link_add(cmd_handle, { CMD_READ, 0U, data, data_len });
+}
+
+esp_err_t i2c_master_stop(i2c_cmd_handle_t cmd_handle)
+{
+    return cmd_link_add(cmd_handle, { CMD_STOP, 0U, nullptr, 0U });
+}
+
+/**
+ * @details Runs the command link against the simulated FT6236: the first
+ * byte written after the address sets its register pointer, next written
+ * bytes are stored in registers and read bytes come from them (with
+ * register address auto-increment). The simulated clock advances the bus
+ * transfer time, or the whole timeout if the slave holds SDA low.
+ */
+esp_err_t i2c_master_cmd_begin(i2c_port_t i2c_num, i2c_cmd_handle_t cmd_handle,
+    TickType_t ticks_to_wait)
+{
+    native_i2c_cmd_link_t* link =
+        static_cast<native_i2c_cmd_link_t*>(cmd_handle);
+    native_i2c_cmd_t* cmds = cmd_link_cmds(link);
+    bool expect_address = false;
+    bool expect_reg_address = false;
+    bool reading = false;
+    uint8_t reg = 0U;
+
+    if (link == nullptr)
+    {   return ESP_ERR_INVALID_ARG;   }
+    if (driver_installed == false)
+    {   return ESP_ERR_INVALID_STATE;   }
+
+    i2c_stats.transactions = i2c_stats.transactions + 1U;
+    if ( (fault == NATIVE_I2C_FAULT_STUCK_SDA) || sda_stuck )
+    {
+        sda_stuck = true;
+        sda_stuck_pulses = 0U;
+        bus_time_advance(ticks_to_wait * portTICK_PERIOD_MS * 1000U);
+        return ESP_ERR_TIMEOUT;
+    }
+
+    bus_time_advance((bus_config.master.clk_speed == 0U) ? 0U :
+        static_cast<uint32_t>((cmd_link_bytes(link) * BITS_PER_BYTE *
+        1000000ULL) / bus_config.master.clk_speed));
+    for (uint16_t i = 0U; i < link->count; i++)
+    {
+        native_i2c_cmd_t& cmd = cmds[i];
+        switch (cmd.type)
+        {
+            case CMD_START:
+                expect_address = true;
+                break;
+
+            case CMD_WRITE:
+                if (expect_address)
+                {
+                    // Address not ACK by any device
+                    if ( ((cmd.byte >> 1) != FT6236_I2C_ADDRESS) ||
+                         (fault == NATIVE_I2C_FAULT_NACK) )
+                    {   return ESP_FAIL;   }
+                    reading = ((cmd.byte & 0x01U) == I2C_MASTER_READ);
+                    expect_reg_address = !reading;
+                    expect_address = false;
+                }
+                else if (expect_reg_address)
+                {
+                    reg = cmd.byte;
+                    expect_reg_address = false;
+                }
+                else
+                {
+                    if (reg < FT6236_NUM_REGS)
+                    {   ft6236_regs[reg] = cmd.byte;   }
+                    reg = reg + 1U;
+                }
+                break;
+
+            case CMD_READ:
+                if (reading == false)
+                {   return ESP_FAIL;   }
+                for (size_t n = 0U; n < cmd.length; n++)
+                {
+                    cmd.data[n] = ft6236_reg_read(reg);
+                    if (bus_config.master.clk_speed > FT6236_MAX_FREQUENCY_HZ)
+                    {   cmd.data[n] ^= static_cast<uint8_t>(n);   }
+                    reg = reg + 1U;
+                }
+                i2c_stats.bytes_read = i2c_stats.bytes_read + cmd.length;
+                break;
+
+            case CMD_STOP:
+            default:
+                break;
+        }
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_write_to_device(i2c_port_t i2c_num, uint8_t device_address,
+    const uint8_t* write_buffer, size_t write_size, TickType_t ticks_to_wait)
+{
+    alignas(native_i2c_cmd_t) uint8_t buffer[CMD_LINK_DYNAMIC_SIZE];
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(buffer,
+        sizeof(buffer));
+    esp_err_t rc = cmd_link_add_write(cmd, device_address, write_buffer,
+        write_size);
+
+    if (rc == ESP_OK)
+    {   rc = i2c_master_stop(cmd);   }
+    if (rc == ESP_OK)
+    {   rc = i2c_master_cmd_begin(i2c_num, cmd, ticks_to_wait);   }
+    i2c_cmd_link_delete_static(cmd);
+    return rc;
+}
+
+esp_err_t i2c_master_write_read_device(i2c_port_t i2c_num,
+    uint8_t device_address, const uint8_t* write_buffer, size_t write_size,
+    uint8_t* read_buffer, size_t read_size, TickType_t ticks_to_wait)
+{
+    alignas(native_i2c_cmd_t) uint8_t buffer[CMD_LINK_DYNAMIC_SIZE];
+    i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(buffer,
+        sizeof(buffer));
+    esp_err_t rc = cmd_link_add_write(cmd, device_address, write_buffer,
+        write_size);
+
+    // Repeated start and read
+    if (rc == ESP_OK)
+    {   rc = i2c_master_start(cmd);   }
+    if (rc == ESP_OK)
+    {
+        rc = i2c_master_write_byte(cmd,
+            static_cast<uint8_t>((device_address << 1) | I2C_MASTER_READ),
+            true);
+    }
+    if (rc == ESP_OK)
+    {
+        rc = i2c_master_read(cmd, read_buffer, read_size,
+            I2C_MASTER_LAST_NACK);
+    }
+    if (rc == ESP_OK)
+    {   rc = i2c_master_stop(cmd);   }
+    if (rc == ESP_OK)
+    {   rc = i2c_master_cmd_begin(i2c_num, cmd, ticks_to_wait);   }
+    i2c_cmd_link_delete_static(cmd);
+    return rc;
+}
+
+/*****************************************************************************/
+
+/* Private Functions - Command Link */
+
+static native_i2c_cmd_t* cmd_link_cmds(native_i2c_cmd_link_t* link)
+{
+    return reinterpret_cast<native_i2c_cmd_t*>(
+        reinterpret_cast<uint8_t*>(link) + sizeof(native_i2c_cmd_link_t));
+}
+
+static esp_err_t cmd_link_add(i2c_cmd_handle_t cmd_handle,
+    const native_i2c_cmd_t& cmd)
+{
+    native_i2c_cmd_link_t* link =
+        static_cast<native_i2c_cmd_link_t*>(cmd_handle);
+
+    if (link == nullptr)
+    {   return ESP_ERR_INVALID_ARG;   }
+    if (link->count >= link->capacity)
+    {   return ESP_ERR_NO_MEM;   }
+
+    cmd_link_cmds(link)[link->count] = cmd;
+    link->count = link->count + 1U;
+    return ESP_OK;
+}
+
+static esp_err_t cmd_link_add_write(i2c_cmd_handle_t cmd_handle,
+    const uint8_t device_address, const uint8_t* write_buffer,
+    const size_t write_size)
+{
+    esp_err_t rc = i2c_master_start(cmd_handle);
+
+    if (rc == ESP_OK)
+    {
+        rc = i2c_master_write_byte(cmd_handle,
+            static_cast<uint8_t>((device_address << 1) | I2C_MASTER_WRITE),
+            true);
+    }
+    for (size_t i = 0U; (rc == ESP_OK) && (i < write_size); i++)
+    {   rc = i2c_master_write_byte(cmd_handle, write_buffer[i], true);   }
+    return rc;
+}
+
+static uint32_t cmd_link_bytes(native_i2c_cmd_link_t* link)
+{
+    native_i2c_cmd_t* cmds = cmd_link_cmds(link);
+    uint32_t bytes = 0U;
+
+    for (uint16_t i = 0U; i < link->count; i++)
+    {   bytes = bytes + static_cast<uint32_t>(cmds[i].length);   }
+    return bytes;
+}
+
+/*****************************************************************************/
+
+/* Private Functions - Bus Time */
+
+static void bus_time_advance(const uint32_t us)
+{
+    native_time_advance_us(us);
+    i2c_stats.bus_us = i2c_stats.bus_us + us;
+}
+
+/*****************************************************************************/
+
+/* Private Functions - FT6236 Registers */
+
+static uint8_t ft6236_reg_read(const uint8_t reg)
+{
+    if (reg < FT6236_NUM_REGS)
+    {   return ft6236_regs[reg];   }
+    if ( (reg >= FT6236_REG_ID) &&
+         (reg < FT6236_REG_ID + sizeof(FT6236_ID)) )
+    {   return FT6236_ID[reg - FT6236_REG_ID];   }
+    return 0x00U;
+}
+
+/*****************************************************************************/
@@ -0,0 +1,225 @@
+/**
+ * @file    native_ledc.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build ESP-IDF LEDC driver (records output edges times).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Native Simulation
+#include "native.h"
+
+// ESP-IDF Stand-in
+#include "driver/ledc.h"
+#include "esp_timer.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// Simulated LEDC Timer
+struct native_ledc_timer_t
+{
+    bool configured;
+    uint8_t resolution;
+    uint32_t freq;
+};
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Simulated LEDC timers clock (XTAL)
+static constexpr uint32_t LEDC_CLK_HZ = 40000000UL;
+
+// Clock divider range (fractional divider with 8 bits of decimals)
+static constexpr uint32_t LEDC_MAX_DIV = 1024U;
+
+/*****************************************************************************/
+
+/* In-Scope Functions */
+
+static bool timer_set_freq(native_ledc_timer_t& timer, const uint32_t freq_hz);
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// Simulated LEDC Timers and Channels
+static native_ledc_timer_t timers[LEDC_TIMER_MAX] = {};
+static native_pwm_state_t channels[LEDC_CHANNEL_MAX] = {};
+static uint32_t channels_duty[LEDC_CHANNEL_MAX] = {};
+static ledc_timer_t channels_timer[LEDC_CHANNEL_MAX] = {};
+
+// LEDC Driver Statistics
+static native_ledc_stats_t ledc_stats = {0U, 0U};
+
+/*****************************************************************************/
+
+/* Simulation Control Functions */
+
+native_pwm_state_t native_pwm_state(const uint8_t chan)
+{
+    if (chan >= LEDC_CHANNEL_MAX)
+    {   return native_pwm_state_t{};   }
+
+    native_pwm_state_t state = channels[chan];
+    state.frequency = timers[channels_timer[chan]].freq;
+    return state;
+}
+
+native_ledc_stats_t native_ledc_stats()
+{
+    return ledc_stats;
+}
+
+/*****************************************************************************/
+
+/* ESP-IDF Stand-in Functions */
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t* timer_conf)
+{
+    if ( (timer_conf == nullptr) || (timer_conf->timer_num >= LEDC_TIMER_MAX) )
+    {   return ESP_ERR_INVALID_ARG;   }
+
+    native_ledc_timer_t& timer = timers[timer_conf->timer_num];
+    ledc_stats.timer_configs = ledc_stats.timer_configs + 1U;
+    timer.configured = false;
+    timer.resolution = static_cast<uint8_t>(timer_conf->duty_resolution);
+    if (timer_set_freq(timer, timer_conf->freq_hz) == false)
+    {   return ESP_FAIL;   }
+    timer.configured = true;
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_freq(ledc_mode_t speed_mode, ledc_timer_t timer_num,
+    uint32_t freq_hz)
+{
+    if (timer_num >= LEDC_TIMER_MAX)
+    {   return ESP_ERR_INVALID_ARG;   }
+    if (timers[timer_num].configured == false)
+    {   return ESP_ERR_INVALID_STATE;   }
+
+    ledc_stats.freq_changes = ledc_stats.freq_changes + 1U;
+    if (timer_set_freq(timers[timer_num], freq_hz) == false)
+    {   return ESP_FAIL;   }
+    return ESP_OK;
+}
+
+uint32_t ledc_get_freq(ledc_mode_t speed_mode, ledc_timer_t timer_num)
+{
+    if (timer_num >= LEDC_TIMER_MAX)
+    {   return 0U;   }
+    return timers[timer_num].freq;
+}
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t* ledc_conf)
+{
+    if ( (ledc_conf == nullptr) || (ledc_conf->channel >= LEDC_CHANNEL_MAX) ||
+         (ledc_conf->timer_sel >= LEDC_TIMER_MAX) )
+    {   return ESP_ERR_INVALID_ARG;   }
+
+    channels_timer[ledc_conf->channel] = ledc_conf->timer_sel;
+    channels_duty[ledc_conf->channel] = ledc_conf->duty;
+    return ledc_update_duty(ledc_conf->speed_mode, ledc_conf->channel);
+}
+
+esp_err_t ledc_set_duty(ledc_mode_t speed_mode, ledc_channel_t channel,
+    uint32_t duty)
+{
+    if (channel >= LEDC_CHANNEL_MAX)
+    {   return ESP_ERR_INVALID_ARG;   }
+    channels_duty[channel] = duty;
+    return ESP_OK;
+}
+
+uint32_t ledc_get_duty(ledc_mode_t speed_mode, ledc_channel_t channel)
+{
+    if (channel >= LEDC_CHANNEL_MAX)
+    {   return 0U;   }
+    return channels[channel].duty;
+}
+
+/**
+ * @details The new duty is applied to the output, recording the time of
+ * the output switch on and off edges.
+ */
+esp_err_t ledc_update_duty(ledc_mode_t speed_mode, ledc_channel_t channel)
+{
+    if (channel >= LEDC_CHANNEL_MAX)
+    {   return ESP_ERR_INVALID_ARG;   }
+
+    native_pwm_state_t& state = channels[channel];
+    uint32_t duty = channels_duty[channel];
+    if ( (state.duty == 0U) && (duty != 0U) )
+    {
+        state.on_us = esp_timer_get_time();
+        state.on_edges = state.on_edges + 1U;
+    }
+    else if ( (state.duty != 0U) && (duty == 0U) )
+    {   state.off_us = esp_timer_get_time();   }
+    state.duty = duty;
+    return ESP_OK;
+}
+
+esp_err_t ledc_stop(ledc_mode_t speed_mode, ledc_channel_t channel,
+    uint32_t idle_level)
+{
+    if (channel >= LEDC_CHANNEL_MAX)
+    {   return ESP_ERR_INVALID_ARG;   }
+    channels_duty[channel] = 0U;
+    return ledc_update_duty(speed_mode, channel);
+}
+
+/*****************************************************************************/
+
+/* Private Functions */
+
+/**
+ * @details Frequency must be reachable with the timer resolution and the
+ * clock divider range.
+ */
+static bool timer_set_freq(native_ledc_timer_t& timer, const uint32_t freq_hz)
+{
+    uint32_t max_freq = LEDC_CLK_HZ >> timer.resolution;
+
+    if ( (freq_hz == 0U) || (freq_hz > max_freq) ||
+         (freq_hz < max_freq / LEDC_MAX_DIV) )
+    {   return false;   }
+
+    timer.freq = freq_hz;
+    return true;
+}
+
+/*****************************************************************************/
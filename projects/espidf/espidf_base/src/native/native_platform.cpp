@@ -0,0 +1,667 @@
+/**
+ * @file    native_platform.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) build implementation of ESP-IDF platform functions.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "native.h"
+
+// Standard C Libraries
+#include <stdlib.h>
+#include <string.h>
+
+// ESP-IDF Stand-in
+#include "driver/gpio.h"
+#include "esp_heap_caps.h"
+#include "esp_intr_alloc.h"
+#include "esp_psram.h"
+#include "esp_rom_sys.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "hal/lcd_ll.h"
+#include "soc/interrupts.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// Native Queue (ring buffer of fixed size items)
+struct native_queue_t
+{
+    uint32_t length;
+    uint32_t item_size;
+    uint32_t head;
+    uint32_t count;
+    uint8_t* items;
+};
+
+// Native esp_timer (one-shot)
+struct esp_timer
+{
+    esp_timer_cb_t callback;
+    void* arg;
+    int64_t expiry_us;
+    bool active;
+};
+
+// Native Task (enabled by the test, its steps are run by the test itself)
+struct native_task_t
+{
+    const char* name;
+    bool created;
+    uint32_t notifications;
+};
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Simulated PSRAM size (ESP32-S3-N16R8)
+static constexpr size_t PSRAM_SIZE = 8U * 1024U * 1024U;
+
+// Simulated internal SRAM available for the application heap
+static constexpr size_t INTERNAL_RAM_SIZE = 320U * 1024U;
+
+// Header placed before each allocation to track its size and memory caps
+static constexpr size_t HEAP_HEADER_SIZE = 16U;
+
+// Maximum number of esp_timers
+static constexpr uint8_t MAX_TIMERS = 8U;
+
+// Number of GPIOs (ESP32-S3)
+static constexpr uint8_t NUM_GPIOS = 49U;
+
+// Maximum number of tasks enabled by the test
+static constexpr uint8_t MAX_TASKS = 4U;
+
+/*****************************************************************************/
+
+/* Global Elements */
+
+// LCD_CAM peripheral interrupt registers (hal/lcd_ll.h)
+lcd_cam_dev_t LCD_CAM = {0U, 0U};
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// Simulated Clock
+static int64_t time_us = 0;
+
+// esp_timers
+static esp_timer timers[MAX_TIMERS];
+static uint8_t num_timers = 0U;
+
+// Heap Statistics
+static native_heap_stats_t heap_stats = {0U, 0U, 0U, 0U};
+
+// Heap bytes in use from PSRAM (the rest are in internal RAM)
+static size_t heap_psram_used = 0U;
+
+// Heap bytes limit of PSRAM and internal RAM set by the test
+static size_t heap_psram_limit = SIZE_MAX;
+static size_t heap_internal_limit = SIZE_MAX;
+
+// Output level of each GPIO (other than the I2C bus ones)
+static uint8_t gpio_levels[NUM_GPIOS] = {0U};
+
+// Interrupt edge and handler of each GPIO
+static gpio_int_type_t gpio_intr_types[NUM_GPIOS] = {GPIO_INTR_DISABLE};
+static gpio_isr_t gpio_isr_handlers[NUM_GPIOS] = {nullptr};
+static void* gpio_isr_args[NUM_GPIOS] = {nullptr};
+
+// LCD_CAM interrupt handler
+static intr_handler_t lcd_cam_isr_handler = nullptr;
+static void* lcd_cam_isr_arg = nullptr;
+
+// Tasks enabled by the test and the one that is running (null for main)
+static native_task_t tasks[MAX_TASKS];
+static uint8_t num_tasks = 0U;
+static native_task_t* task_running = nullptr;
+
+/*****************************************************************************/
+
+/* Simulation Control Functions */
+
+void native_time_advance_ms(const uint32_t ms)
+{
+    native_time_advance_us(ms * 1000U);
+}
+
+/**
+ * @details Expired timers run in expiry order, each one with the clock set
+ * at its exact expiry time (as the esp_timer task would run them).
+ */
+void native_time_advance_us(const uint32_t us)
+{
+    int64_t target_us = time_us + static_cast<int64_t>(us);
+
+    while (true)
+    {
+        esp_timer* next = nullptr;
+        for (uint8_t i = 0U; i < num_timers; i++)
+        {
+            if ( (timers[i].active == false) ||
+                 (timers[i].expiry_us > target_us) )
+            {   continue;   }
+            if ( (next == nullptr) || (timers[i].expiry_us < next->expiry_us) )
+            {   next = &timers[i];   }
+        }
+        if (next == nullptr)
+        {   break;   }
+
+        if (next->expiry_us > time_us)
+        {   time_us = next->expiry_us;   }
+        next->active = false;
+        next->callback(next->arg);
+    }
+    if (target_us > time_us)
+    {   time_us = target_us;   }
+}
+
+native_heap_stats_t native_heap_stats()
+{
+    return heap_stats;
+}
+
+void native_heap_set_free(const uint32_t caps, const size_t free_bytes)
+{
+    size_t used = heap_psram_used;
+    size_t* limit = &heap_psram_limit;
+
+    if ( (caps & MALLOC_CAP_SPIRAM) == 0U )
+    {
+        used = heap_stats.used - heap_psram_used;
+        limit = &heap_internal_limit;
+    }
+    *limit = (free_bytes > (SIZE_MAX - used)) ? SIZE_MAX : used + free_bytes;
+}
+
+void native_task_enable(const char* name)
+{
+    if (num_tasks >= MAX_TASKS)
+    {   return;   }
+    tasks[num_tasks].name = name;
+    tasks[num_tasks].created = false;
+    tasks[num_tasks].notifications = 0U;
+    num_tasks = num_tasks + 1U;
+}
+
+void native_task_switch(void* task)
+{
+    task_running = static_cast<native_task_t*>(task);
+}
+
+uint32_t native_task_notifications(void* task)
+{
+    if (task == nullptr)
+    {   return 0U;   }
+    return static_cast<native_task_t*>(task)->notifications;
+}
+
+/**
+ * @details The interrupt handler runs in place when the level change matches
+ * the configured edge, as the GPIO ISR service would run it.
+ */
+void native_gpio_input(const int gpio_num, const uint32_t level)
+{
+    if ( (gpio_num < 0) || (gpio_num >= NUM_GPIOS) )
+    {   return;   }
+
+    uint8_t last_level = gpio_levels[gpio_num];
+    uint8_t new_level = (level != 0U) ? 1U : 0U;
+    gpio_levels[gpio_num] = new_level;
+    if ( (new_level == last_level) ||
+         (gpio_isr_handlers[gpio_num] == nullptr) )
+    {   return;   }
+
+    gpio_int_type_t edge = (new_level != 0U) ?
+        GPIO_INTR_POSEDGE : GPIO_INTR_NEGEDGE;
+    if ( (gpio_intr_types[gpio_num] == edge) ||
+         (gpio_intr_types[gpio_num] == GPIO_INTR_ANYEDGE) )
+    {   gpio_isr_handlers[gpio_num](gpio_isr_args[gpio_num]);   }
+}
+
+void native_lcd_trans_done()
+{
+    LCD_CAM.int_raw = LCD_CAM.int_raw | LCD_LL_EVENT_TRANS_DONE;
+    if ( (lcd_cam_isr_handler != nullptr) &&
+         (lcd_ll_get_interrupt_status(&LCD_CAM) != 0U) )
+    {   lcd_cam_isr_handler(lcd_cam_isr_arg);   }
+}
+
+/*****************************************************************************/
+
+/* ESP-IDF Stand-in Functions */
+
+int64_t esp_timer_get_time(void)
+{
+    return time_us;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args,
+    esp_timer_handle_t* out_handle)
+{
+    if ( (create_args == nullptr) || (create_args->callback == nullptr) )
+    {   return ESP_ERR_INVALID_ARG;   }
+    if (num_timers >= MAX_TIMERS)
+    {   return ESP_ERR_NO_MEM;   }
+
+    esp_timer* timer = &timers[num_timers];
+    num_timers = num_timers + 1U;
+    timer->callback = create_args->callback;
+    timer->arg = create_args->arg;
+    timer->expiry_us = 0;
+    timer->active = false;
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    if (timer->active)
+    {   return ESP_ERR_INVALID_STATE;   }
+    timer->expiry_us = time_us + static_cast<int64_t>(timeout_us);
+    timer->active = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    if (timer->active == false)
+    {   return ESP_ERR_INVALID_STATE;   }
+    timer->active = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+    timer->active = false;
+    timer->callback = nullptr;
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer)
+{
+    return timer->active;
+}
+
+void vTaskDelay(const TickType_t ticks)
+{
+    native_time_advance_ms(ticks * portTICK_PERIOD_MS);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task_code,
+    const char* name, const uint32_t stack_depth, void* parameters,
+    UBaseType_t priority, TaskHandle_t* created_task, const BaseType_t core)
+{
+    for (uint8_t i = 0U; i < num_tasks; i++)
+    {
+        if ( (tasks[i].created) || (strcmp(tasks[i].name, name) != 0) )
+        {   continue;   }
+        tasks[i].created = true;
+        if (created_task != nullptr)
+        {   *created_task = &tasks[i];   }
+        return pdPASS;
+    }
+    return pdFAIL;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    if (task != nullptr)
+    {
+        native_task_t* native_task = static_cast<native_task_t*>(task);
+        native_task->notifications = native_task->notifications + 1U;
+    }
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task,
+    BaseType_t* higher_priority_task_woken)
+{
+    xTaskNotifyGive(task);
+    if (higher_priority_task_woken != nullptr)
+    {   *higher_priority_task_woken = pdTRUE;   }
+}
+
+/**
+ * @details Nothing can notify while blocked (single thread), so a take
+ * without pending notifications returns at once after advancing the clock
+ * the timeout (or without advancing it, if the wait is unlimited).
+ */
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+    if (task_running == nullptr)
+    {   return 0U;   }
+
+    uint32_t notifications = task_running->notifications;
+    if (notifications == 0U)
+    {
+        if (ticks_to_wait != portMAX_DELAY)
+        {   native_time_advance_ms(ticks_to_wait * portTICK_PERIOD_MS);   }
+        return 0U;
+    }
+
+    if (clear_on_exit)
+    {   task_running->notifications = 0U;   }
+    else
+    {   task_running->notifications = notifications - 1U;   }
+    return notifications;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return task_running;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* buffer)
+{
+    buffer->count = 0U;
+    return buffer;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* buffer)
+{
+    buffer->count = 1U;
+    return buffer;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    if (semaphore->count > 0U)
+    {   return pdFAIL;   }
+    semaphore->count = 1U;
+    return pdPASS;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore,
+    TickType_t ticks_to_wait)
+{
+    if (semaphore->count == 0U)
+    {   return pdFAIL;   }
+    semaphore->count = 0U;
+    return pdPASS;
+}
+
+QueueHandle_t xQueueCreate(const UBaseType_t length,
+    const UBaseType_t item_size)
+{
+    native_queue_t* queue = new native_queue_t;
+    queue->length = length;
+    queue->item_size = item_size;
+    queue->head = 0U;
+    queue->count = 0U;
+    queue->items = new uint8_t[length * item_size];
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item,
+    TickType_t ticks_to_wait)
+{
+    if (queue->count >= queue->length)
+    {   return pdFALSE;   }
+
+    uint32_t tail = (queue->head + queue->count) % queue->length;
+    memcpy(&queue->items[tail * queue->item_size], item, queue->item_size);
+    queue->count = queue->count + 1U;
+    return pdTRUE;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item,
+    BaseType_t* higher_priority_task_woken)
+{
+    if (xQueueSend(queue, item, 0U) != pdTRUE)
+    {   return pdFALSE;   }
+    if (higher_priority_task_woken != nullptr)
+    {   *higher_priority_task_woken = pdTRUE;   }
+    return pdTRUE;
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item)
+{
+    queue->head = 0U;
+    queue->count = 0U;
+    return xQueueSend(queue, item, 0U);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item,
+    TickType_t ticks_to_wait)
+{
+    if (xQueuePeek(queue, item, ticks_to_wait) == pdFALSE)
+    {   return pdFALSE;   }
+
+    queue->head = (queue->head + 1U) % queue->length;
+    queue->count = queue->count - 1U;
+    return pdTRUE;
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void* item,
+    TickType_t ticks_to_wait)
+{
+    if (queue->count == 0U)
+    {   return pdFALSE;   }
+
+    memcpy(item, &queue->items[queue->head * queue->item_size],
+        queue->item_size);
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(const QueueHandle_t queue)
+{
+    return queue->count;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+    queue->head = 0U;
+    queue->count = 0U;
+    return pdPASS;
+}
+
+esp_err_t gpio_config(const gpio_config_t* config)
+{
+    for (uint8_t i = 0U; i < NUM_GPIOS; i++)
+    {
+        if ( (config->pin_bit_mask & (1ULL << i)) != 0U )
+        {   gpio_intr_types[i] = config->intr_type;   }
+    }
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    if ( (gpio_num < 0) || (gpio_num >= NUM_GPIOS) )
+    {   return ESP_ERR_INVALID_ARG;   }
+    gpio_levels[gpio_num] = (level != 0U) ? 1U : 0U;
+    native_i2c_gpio_set_level(gpio_num, level);
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    if ( (gpio_num < 0) || (gpio_num >= NUM_GPIOS) )
+    {   return 0;   }
+    int level = native_i2c_gpio_get_level(gpio_num);
+    return (level < 0) ? gpio_levels[gpio_num] : level;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler,
+    void* args)
+{
+    if ( (gpio_num < 0) || (gpio_num >= NUM_GPIOS) )
+    {   return ESP_ERR_INVALID_ARG;   }
+    gpio_isr_handlers[gpio_num] = isr_handler;
+    gpio_isr_args[gpio_num] = args;
+    return ESP_OK;
+}
+
+esp_err_t esp_intr_alloc(int source, int flags, intr_handler_t handler,
+    void* arg, intr_handle_t* ret_handle)
+{
+    if ( (source != ETS_LCD_CAM_INTR_SOURCE) || (handler == nullptr) )
+    {   return ESP_ERR_NOT_SUPPORTED;   }
+    lcd_cam_isr_handler = handler;
+    lcd_cam_isr_arg = arg;
+    if (ret_handle != nullptr)
+    {   *ret_handle = &lcd_cam_isr_handler;   }
+    return ESP_OK;
+}
+
+void esp_rom_delay_us(uint32_t us)
+{
+    native_time_advance_us(us);
+}
+
+size_t esp_psram_get_size(void)
+{
+    return PSRAM_SIZE;
+}
+
+const char* esp_get_idf_version(void)
+{
+    return "native";
+}
+
+void* heap_caps_malloc(size_t size, uint32_t caps)
+{
+    size_t used = heap_stats.used - heap_psram_used;
+    size_t limit = heap_internal_limit;
+    if (caps & MALLOC_CAP_SPIRAM)
+    {
+        used = heap_psram_used;
+        limit = heap_psram_limit;
+    }
+    if (size > (limit - used))
+    {   return nullptr;   }
+
+    uint8_t* block = static_cast<uint8_t*>(malloc(HEAP_HEADER_SIZE + size));
+    if (block == nullptr)
+    {   return nullptr;   }
+
+    *reinterpret_cast<size_t*>(block) = size;
+    *reinterpret_cast<uint32_t*>(block + sizeof(size_t)) = caps;
+    if (caps & MALLOC_CAP_SPIRAM)
+    {   heap_psram_used = heap_psram_used + size;   }
+    heap_stats.used = heap_stats.used + size;
+    heap_stats.allocs = heap_stats.allocs + 1U;
+    if (heap_stats.used > heap_stats.peak)
+    {   heap_stats.peak = heap_stats.used;   }
+
+    return (block + HEAP_HEADER_SIZE);
+}
+
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps)
+{
+    if (ptr == nullptr)
+    {   return heap_caps_malloc(size, caps);   }
+
+    uint8_t* block = static_cast<uint8_t*>(ptr) - HEAP_HEADER_SIZE;
+    size_t old_size = *reinterpret_cast<size_t*>(block);
+    uint32_t old_caps = *reinterpret_cast<uint32_t*>(block + sizeof(size_t));
+    block = static_cast<uint8_t*>(realloc(block, HEAP_HEADER_SIZE + size));
+    if (block == nullptr)
+    {   return nullptr;   }
+
+    *reinterpret_cast<size_t*>(block) = size;
+    if (old_caps & MALLOC_CAP_SPIRAM)
+    {   heap_psram_used = heap_psram_used - old_size + size;   }
+    heap_stats.used = heap_stats.used - old_size + size;
+    if (heap_stats.used > heap_stats.peak)
+    {   heap_stats.peak = heap_stats.used;   }
+
+    return (block + HEAP_HEADER_SIZE);
+}
+
+void heap_caps_free(void* ptr)
+{
+    if (ptr == nullptr)
+    {   return;   }
+
+    uint8_t* block = static_cast<uint8_t*>(ptr) - HEAP_HEADER_SIZE;
+    size_t size = *reinterpret_cast<size_t*>(block);
+    uint32_t caps = *reinterpret_cast<uint32_t*>(block + sizeof(size_t));
+    if (caps & MALLOC_CAP_SPIRAM)
+    {   heap_psram_used = heap_psram_used - size;   }
+    heap_stats.used = heap_stats.used - size;
+    heap_stats.frees = heap_stats.frees + 1U;
+    free(block);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    size_t used = heap_stats.used - heap_psram_used;
+    size_t size = INTERNAL_RAM_SIZE;
+    size_t limit = heap_internal_limit;
+    if (caps & MALLOC_CAP_SPIRAM)
+    {
+        used = heap_psram_used;
+        size = PSRAM_SIZE;
+        limit = heap_psram_limit;
+    }
+    if (limit < size)
+    {   size = limit;   }
+
+    if (used > size)
+    {   return 0U;   }
+    return (size - used);
+}
+
+// The host heap does not fragment the simulated memory
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return heap_caps_get_free_size(caps);
+}
+
+/*****************************************************************************/
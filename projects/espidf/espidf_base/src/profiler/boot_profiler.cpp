@@ -0,0 +1,141 @@
+/**
+ * @file    boot_profiler.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Boot phases time profiler.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "boot_profiler.h"
+
+// Standard C++ Libraries
+#include <cstdio>
+#include <cstring>
+
+// ESP-IDF Framework
+#include "esp_timer.h"
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+BootProfiler::BootProfiler()
+{
+    memset(phases, 0, sizeof(phases));
+}
+
+/**
+ * @details Returns the phase identifier to end it, or MAX_PHASES if there
+ * is no room left to record it (end() ignores it).
+ */
+uint8_t BootProfiler::begin(const char* name)
+{
+    uint32_t t_start_us = (uint32_t)(esp_timer_get_time());
+    uint8_t id = num_phases.load();
+
+    do
+    {
+        if (id >= MAX_PHASES)
+        {   return MAX_PHASES;   }
+    } while (num_phases.compare_exchange_weak(id, id + 1U) == false);
+
+    phases[id].name = name;
+    phases[id].t_start_us = t_start_us;
+    phases[id].t_end_us = 0U;
+    phases[id].ended = false;
+    return id;
+}
+
+void BootProfiler::end(const uint8_t id)
+{
+    if (id >= MAX_PHASES)
+    {   return;   }
+    phases[id].t_end_us = (uint32_t)(esp_timer_get_time());
+    phases[id].ended = true;
+}
+
+/**
+ * @details Boot event, a phase that ends when it starts.
+ */
+void BootProfiler::mark(const char* name)
+{
+    end(begin(name));
+}
+
+const BootProfiler::phase_t* BootProfiler::get_phase(const char* name)
+{
+    uint8_t count = num_phases.load();
+
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        if ( (phases[i].name != nullptr) &&
+             (strcmp(phases[i].name, name) == 0) )
+        {   return &phases[i];   }
+    }
+    return nullptr;
+}
+
+/**
+ * @details Times in ms with one decimal (no float printf).
+ */
+void BootProfiler::dump()
+{
+    uint8_t count = num_phases.load();
+
+    printf("\n[Boot Profiler] Phases: %u (times since app startup)\n",
+        (unsigned)(count));
+    printf("  %-14s %10s %10s %10s\n", "Phase", "start_ms", "end_ms",
+        "time_ms");
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        const phase_t& phase = phases[i];
+        uint32_t start_x10 = phase.t_start_us / 100U;
+        if (phase.ended == false)
+        {
+            printf("  %-14s %8lu.%lu %10s %10s\n", phase.name,
+                (unsigned long)(start_x10 / 10U),
+                (unsigned long)(start_x10 % 10U), "-", "-");
+            continue;
+        }
+        uint32_t end_x10 = phase.t_end_us / 100U;
+        uint32_t time_x10 = (phase.t_end_us - phase.t_start_us) / 100U;
+        printf("  %-14s %8lu.%lu %8lu.%lu %8lu.%lu\n", phase.name,
+            (unsigned long)(start_x10 / 10U), (unsigned long)(start_x10 % 10U),
+            (unsigned long)(end_x10 / 10U), (unsigned long)(end_x10 % 10U),
+            (unsigned long)(time_x10 / 10U), (unsigned long)(time_x10 % 10U));
+    }
+}
+
+/*****************************************************************************/
@@ -0,0 +1,105 @@
+/**
+ * @file    boot_profiler.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Boot phases time profiler.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef BOOT_PROFILER_H
+#define BOOT_PROFILER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <atomic>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @details Records the start and end time of each boot phase (since the
+ * app startup, esp_timer time). Phases can run in parallel on different
+ * tasks: each one gets its own record, and its name must be a string
+ * literal (only its pointer is kept).
+ */
+class BootProfiler
+{
+    public:
+
+        /**
+         * @brief Maximum number of recorded phases.
+         */
+        static constexpr uint8_t MAX_PHASES = 16U;
+
+        /**
+         * @brief Boot phase record.
+         */
+        struct phase_t
+        {
+            const char* name;
+            uint32_t t_start_us;
+            uint32_t t_end_us;
+            bool ended;
+        };
+
+        BootProfiler();
+
+        uint8_t begin(const char* name);
+
+        void end(const uint8_t id);
+
+        void mark(const char* name);
+
+        const phase_t* get_phase(const char* name);
+
+        void dump();
+
+    /******************************************************************/
+
+    private:
+
+        phase_t phases[MAX_PHASES];
+        std::atomic<uint8_t> num_phases{0U};
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* BOOT_PROFILER_H */
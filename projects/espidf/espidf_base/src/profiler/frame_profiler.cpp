@@ -0,0 +1,260 @@
+/**
+ * @file    frame_profiler.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Render pipeline frame-time profiler.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "frame_profiler.h"
+
+// Standard C++ Libraries
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+// ESP-IDF Framework
+#include "esp_timer.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Frame Time (render start to last area sent) Histogram Buckets upper
+// limits
+static constexpr uint32_t HISTOGRAM_LIMITS_US[] =
+    { 5000U, 10000U, 16667U, 33333U, 50000U };
+static constexpr uint8_t HISTOGRAM_NUM_LIMITS =
+    sizeof(HISTOGRAM_LIMITS_US) / sizeof(HISTOGRAM_LIMITS_US[0]);
+
+/*****************************************************************************/
+
+/* In-Scope Functions */
+
+static inline int64_t micros();
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// Scratch buffer to sort the values of a metric
+static uint32_t sorted_values[FrameProfiler::NUM_FRAMES];
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+FrameProfiler::FrameProfiler()
+{
+    reset();
+}
+
+void FrameProfiler::loop_start()
+{
+    t_loop_start = micros();
+
+    // Time since last loop end was spent waiting (idle)
+    if (t_loop_end != 0)
+    {
+        frame_idle_us = frame_idle_us +
+            static_cast<uint32_t>(t_loop_start - t_loop_end);
+    }
+}
+
+void FrameProfiler::loop_end()
+{
+    t_loop_end = micros();
+}
+
+void FrameProfiler::frame_start()
+{
+    t_frame_start = micros();
+    t_render_end = 0;
+    frame_wait_us = 0U;
+    frame_flush_us = 0U;
+    frame_area_px = 0U;
+}
+
+/**
+ * @details Called when the last area of the frame is rendered, before it is
+ * sent.
+ */
+void FrameProfiler::render_end()
+{
+    t_render_end = micros();
+}
+
+/**
+ * @details Called when the last area of the frame is sent (its buffer
+ * released), that may be some loops after it was rendered (DMA transfer).
+ */
+void FrameProfiler::frame_end()
+{
+    int64_t t_frame_end = micros();
+
+    // Frame end without its start (i.e. profiler reset while sending it)
+    if ( (t_frame_start == 0) || (t_render_end < t_frame_start) )
+    {   return;   }
+
+    uint32_t render_us = static_cast<uint32_t>(t_render_end - t_frame_start);
+    frame_t& frame = frames[head];
+    frame.frame_us = static_cast<uint32_t>(t_frame_end - t_frame_start);
+    frame.render_us = (render_us > frame_wait_us) ?
+        (render_us - frame_wait_us) : 0U;
+    frame.flush_us = frame_flush_us;
+    frame.area_px = frame_area_px;
+    frame.idle_us = frame_idle_us;
+
+    head = (head + 1U) % NUM_FRAMES;
+    if (count < NUM_FRAMES)
+    {   count = count + 1U;   }
+    total_frames = total_frames + 1U;
+
+    t_frame_start = 0;
+    frame_idle_us = 0U;
+}
+
+/**
+ * @details Time the render was blocked on the bus (synchronous writes,
+ * transfer launches and waits for a render buffer).
+ */
+void FrameProfiler::add_wait(const uint32_t wait_us)
+{
+    frame_wait_us = frame_wait_us + wait_us;
+}
+
+/**
+ * @details Send time of an area, from its write start until its buffer is
+ * released.
+ */
+void FrameProfiler::add_flush(const uint32_t flush_us, const uint32_t area_px)
+{
+    frame_flush_us = frame_flush_us + flush_us;
+    frame_area_px = frame_area_px + area_px;
+}
+
+const FrameProfiler::frame_t* FrameProfiler::last_frame()
+{
+    if (count == 0U)
+    {   return nullptr;   }
+    return &frames[(head + NUM_FRAMES - 1U) % NUM_FRAMES];
+}
+
+void FrameProfiler::reset()
+{
+    memset(frames, 0, sizeof(frames));
+    head = 0U;
+    count = 0U;
+    total_frames = 0U;
+    t_frame_start = 0;
+    t_render_end = 0;
+    frame_wait_us = 0U;
+    frame_flush_us = 0U;
+    frame_area_px = 0U;
+    frame_idle_us = 0U;
+}
+
+void FrameProfiler::dump()
+{
+    uint32_t histogram[HISTOGRAM_NUM_LIMITS + 1U] = {0U};
+
+    printf("\n[Profiler] Frames: %u (of %lu)\n", count,
+        (unsigned long)(total_frames));
+    if (count == 0U)
+    {   return;   }
+
+    printf("  %-10s %10s %10s %10s %10s\n", "Metric", "min", "avg", "p99",
+        "max");
+    dump_metric("frame_us", offsetof(frame_t, frame_us));
+    dump_metric("render_us", offsetof(frame_t, render_us));
+    dump_metric("flush_us", offsetof(frame_t, flush_us));
+    dump_metric("area_px", offsetof(frame_t, area_px));
+    dump_metric("idle_us", offsetof(frame_t, idle_us));
+
+    for (uint16_t i = 0U; i < count; i++)
+    {
+        uint32_t frame_us = frames[i].frame_us;
+        uint8_t bucket = 0U;
+        while ( (bucket < HISTOGRAM_NUM_LIMITS) &&
+                (frame_us >= HISTOGRAM_LIMITS_US[bucket]) )
+        {   bucket = bucket + 1U;   }
+        histogram[bucket] = histogram[bucket] + 1U;
+    }
+
+    printf("  Frame time (render start to last area sent) histogram:\n");
+    for (uint8_t i = 0U; i < HISTOGRAM_NUM_LIMITS; i++)
+    {
+        printf("    < %5lu us: %lu\n", (unsigned long)(HISTOGRAM_LIMITS_US[i]),
+            (unsigned long)(histogram[i]));
+    }
+    printf("    >=%5lu us: %lu\n",
+        (unsigned long)(HISTOGRAM_LIMITS_US[HISTOGRAM_NUM_LIMITS - 1U]),
+        (unsigned long)(histogram[HISTOGRAM_NUM_LIMITS]));
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+void FrameProfiler::dump_metric(const char* name, const size_t offset)
+{
+    uint64_t sum = 0U;
+
+    for (uint16_t i = 0U; i < count; i++)
+    {
+        const uint8_t* frame = reinterpret_cast<const uint8_t*>(&frames[i]);
+        memcpy(&sorted_values[i], frame + offset, sizeof(uint32_t));
+        sum = sum + sorted_values[i];
+    }
+    std::sort(sorted_values, sorted_values + count);
+
+    uint16_t p99_index = ((count * 99U) + 99U) / 100U - 1U;
+    printf("  %-10s %10lu %10lu %10lu %10lu\n", name,
+        (unsigned long)(sorted_values[0]), (unsigned long)(sum / count),
+        (unsigned long)(sorted_values[p99_index]),
+        (unsigned long)(sorted_values[count - 1U]));
+}
+
+/*****************************************************************************/
+
+/* Private Methods - Micros */
+
+static inline int64_t micros()
+{
+    return esp_timer_get_time();
+}
+
+/*****************************************************************************/
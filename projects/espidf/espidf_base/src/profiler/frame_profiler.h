@@ -0,0 +1,126 @@
+/**
+ * @file    frame_profiler.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Render pipeline frame-time profiler.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+class FrameProfiler
+{
+    public:
+
+        /**
+         * @brief Number of last frames kept in the ring buffer.
+         */
+        static constexpr uint16_t NUM_FRAMES = 128U;
+
+        /**
+         * @brief Frame record: time from its render start until its last
+         * area is sent, render time (not blocked on the bus), areas send
+         * time (until each one is released, DMA transfers included),
+         * flushed area and idle time since the previous frame.
+         */
+        struct frame_t
+        {
+            uint32_t frame_us;
+            uint32_t render_us;
+            uint32_t flush_us;
+            uint32_t area_px;
+            uint32_t idle_us;
+        };
+
+        FrameProfiler();
+
+        void loop_start();
+
+        void loop_end();
+
+        void frame_start();
+
+        void render_end();
+
+        void frame_end();
+
+        void add_wait(const uint32_t wait_us);
+
+        void add_flush(const uint32_t flush_us, const uint32_t area_px);
+
+        const frame_t* last_frame();
+
+        void reset();
+
+        void dump();
+
+    /******************************************************************/
+
+    private:
+
+        frame_t frames[NUM_FRAMES];
+        uint16_t head = 0U;
+        uint16_t count = 0U;
+        uint32_t total_frames = 0U;
+
+        int64_t t_loop_start = 0;
+        int64_t t_loop_end = 0;
+        int64_t t_frame_start = 0;
+        int64_t t_render_end = 0;
+        uint32_t frame_wait_us = 0U;
+        uint32_t frame_flush_us = 0U;
+        uint32_t frame_area_px = 0U;
+        uint32_t frame_idle_us = 0U;
+
+        void dump_metric(const char* name, const size_t offset);
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* FRAME_PROFILER_H */
@@ -0,0 +1,99 @@
+/**
+ * @file    touch_i2c.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Touch Panel I2C transport (FT6236 driver I2C policy), through the
+ * I2C Bus Scheduler with the Touch Panel priority, deadline and frequency.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "touch_i2c.h"
+
+// Project Headers
+#include "config/config.h"
+#include "memory/hot_path.h"
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+I2CScheduler* TouchI2C::bus = nullptr;
+uint32_t TouchI2C::frequency = 0U;
+
+/*****************************************************************************/
+
+/* Public Functions */
+
+void TouchI2C::attach(I2CScheduler* i2c_bus)
+{
+    bus = i2c_bus;
+}
+
+void TouchI2C::set_frequency(const uint32_t i2c_frequency)
+{
+    frequency = i2c_frequency;
+}
+
+uint32_t TouchI2C::get_frequency()
+{
+    return frequency;
+}
+
+bool HOT_PATH TouchI2C::read_registers(const uint16_t address,
+    const uint8_t reg, uint8_t* data, const size_t length)
+{
+    if (bus == nullptr)
+    {   return false;   }
+
+    i2c_device_t device = { address, I2C_PRIORITY_TOUCH,
+        ns_const::TOUCH_I2C_DEADLINE_MS, frequency };
+    i2c_result_t result = bus->read_registers_sync(device, reg, data,
+        length);
+    return (result == I2C_RESULT_OK);
+}
+
+bool TouchI2C::write_register(const uint16_t address, const uint8_t reg,
+    const uint8_t value)
+{
+    if (bus == nullptr)
+    {   return false;   }
+
+    i2c_device_t device = { address, I2C_PRIORITY_TOUCH,
+        ns_const::TOUCH_I2C_DEADLINE_MS, frequency };
+    i2c_result_t result = bus->write_register_sync(device, reg, value);
+    return (result == I2C_RESULT_OK);
+}
+
+/*****************************************************************************/
@@ -0,0 +1,87 @@
+/**
+ * @file    touch_i2c.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Touch Panel I2C transport (FT6236 driver I2C policy), through the
+ * I2C Bus Scheduler with the Touch Panel priority, deadline and frequency.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef TOUCH_I2C_H
+#define TOUCH_I2C_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstddef>
+#include <cstdint>
+
+// I2C Bus Scheduler
+#include "controller/i2c/i2c_scheduler.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+// Touch Panel I2C Transport, through the I2C Bus Scheduler attached to it
+// (transactions fail while there is none)
+struct TouchI2C
+{
+    static void attach(I2CScheduler* i2c_bus);
+
+    static void set_frequency(const uint32_t i2c_frequency);
+
+    static uint32_t get_frequency();
+
+    static bool read_registers(const uint16_t address, const uint8_t reg,
+        uint8_t* data, const size_t length);
+
+    static bool write_register(const uint16_t address, const uint8_t reg,
+        const uint8_t value);
+
+    private:
+
+        // I2C Bus Scheduler and Touch Panel I2C Frequency (0 for bus
+        // default)
+        static I2CScheduler* bus;
+        static uint32_t frequency;
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* TOUCH_I2C_H */
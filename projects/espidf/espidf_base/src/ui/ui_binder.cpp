@@ -0,0 +1,175 @@
+/**
+ * @file    ui_binder.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * UI values data-binding (labels subscribed to values, updated once per frame only when their value changed).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Library Header
+#include "ui_binder.h"
+
+// Standard C++ Libraries
+#include <cstdio>
+#include <cstring>
+
+/*****************************************************************************/
+
+/* Public Methods */
+
+UIBinder::UIBinder()
+{
+    memset(values, 0, sizeof(values));
+    num_bindings = 0U;
+    changed = false;
+    reset();
+}
+
+/**
+ * @details The label is rendered now with the current value.
+ */
+bool UIBinder::bind_label(const uint8_t value_id, lv_obj_t* label,
+    const char* format)
+{
+    if ( (value_id >= MAX_VALUES) || (num_bindings >= MAX_BINDINGS) )
+    {   return false;   }
+
+    binding_t& binding = bindings[num_bindings];
+    binding.value_id = value_id;
+    binding.label = label;
+    binding.format = format;
+    render(binding);
+    num_bindings = num_bindings + 1U;
+
+    return true;
+}
+
+/**
+ * @details Just stores the value, the labels are updated on the next
+ * apply() (several sets of the same frame are coalesced).
+ */
+void UIBinder::set(const uint8_t value_id, const int32_t field0,
+    const int32_t field1)
+{
+    if (value_id >= MAX_VALUES)
+    {   return;   }
+
+    stats.sets = stats.sets + 1U;
+    int32_t* value = values[value_id];
+    if ( (value[0] == field0) && (value[1] == field1) )
+    {
+        stats.sets_unchanged = stats.sets_unchanged + 1U;
+        return;
+    }
+
+    value[0] = field0;
+    value[1] = field1;
+    changed = true;
+}
+
+int32_t UIBinder::get(const uint8_t value_id, const uint8_t field)
+{
+    if ( (value_id >= MAX_VALUES) || (field >= VALUE_FIELDS) )
+    {   return 0;   }
+    return values[value_id][field];
+}
+
+/**
+ * @details Called once per frame before rendering it, updates (and so
+ * invalidates) only the labels whose value is not the rendered one.
+ * Returns the number of labels updated.
+ */
+uint8_t UIBinder::apply()
+{
+    uint8_t updated = 0U;
+
+    stats.frames = stats.frames + 1U;
+    if (changed == false)
+    {   return 0U;   }
+    changed = false;
+
+    for (uint8_t i = 0U; i < num_bindings; i++)
+    {
+        binding_t& binding = bindings[i];
+        const int32_t* value = values[binding.value_id];
+        if ( (binding.rendered[0] == value[0]) &&
+             (binding.rendered[1] == value[1]) )
+        {   continue;   }
+        render(binding);
+        updated = updated + 1U;
+    }
+    stats.labels_updated = stats.labels_updated + updated;
+
+    return updated;
+}
+
+const UIBinder::stats_t& UIBinder::get_stats()
+{
+    return stats;
+}
+
+void UIBinder::reset()
+{
+    stats.frames = 0U;
+    stats.sets = 0U;
+    stats.sets_unchanged = 0U;
+    stats.labels_updated = 0U;
+}
+
+void UIBinder::dump()
+{
+    printf("\n[UI Binder] Frames: %lu, %u labels bound\n",
+        (unsigned long)(stats.frames), (unsigned)(num_bindings));
+    printf("  Value sets: %lu (%lu unchanged)\n",
+        (unsigned long)(stats.sets), (unsigned long)(stats.sets_unchanged));
+    printf("  Labels updated: %lu\n", (unsigned long)(stats.labels_updated));
+}
+
+/*****************************************************************************/
+
+/* Private Methods */
+
+void UIBinder::render(binding_t& binding)
+{
+    char text[TEXT_MAX_LENGTH];
+    const int32_t* value = values[binding.value_id];
+
+    snprintf(text, TEXT_MAX_LENGTH, binding.format, (long)(value[0]),
+        (long)(value[1]));
+    lv_label_set_text(binding.label, text);
+    binding.rendered[0] = value[0];
+    binding.rendered[1] = value[1];
+}
+
+/*****************************************************************************/
@@ -0,0 +1,129 @@
+/**
+ * @file    ui_binder.h
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * UI values data-binding (labels subscribed to values, updated once per frame only when their value changed).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Include Guard */
+
+#ifndef UI_BINDER_H
+#define UI_BINDER_H
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Graphic Libraies
+#include <lvgl.h>
+
+/*****************************************************************************/
+
+/* Class Interface */
+
+/**
+ * @details UI values are tuples of integers identified by their index, and
+ * labels subscribe to a value with a printf format of its fields ("%ld").
+ * Values must only be set from the UI task (no locks).
+ */
+class UIBinder
+{
+    public:
+
+        static constexpr uint8_t MAX_VALUES = 8U;
+        static constexpr uint8_t MAX_BINDINGS = 8U;
+        static constexpr uint8_t VALUE_FIELDS = 2U;
+        static constexpr uint8_t TEXT_MAX_LENGTH = 64U;
+
+        /**
+         * @brief Binder statistics.
+         */
+        struct stats_t
+        {
+            uint32_t frames;
+            uint32_t sets;
+            uint32_t sets_unchanged;
+            uint32_t labels_updated;
+        };
+
+        UIBinder();
+
+        bool bind_label(const uint8_t value_id, lv_obj_t* label,
+            const char* format);
+
+        void set(const uint8_t value_id, const int32_t field0,
+            const int32_t field1 = 0);
+
+        int32_t get(const uint8_t value_id, const uint8_t field = 0U);
+
+        uint8_t apply();
+
+        const stats_t& get_stats();
+
+        void reset();
+
+        void dump();
+
+    /******************************************************************/
+
+    private:
+
+        /**
+         * @brief Label subscribed to a value, with the last value fields
+         * rendered on it.
+         */
+        struct binding_t
+        {
+            uint8_t value_id;
+            lv_obj_t* label;
+            const char* format;
+            int32_t rendered[VALUE_FIELDS];
+        };
+
+        int32_t values[MAX_VALUES][VALUE_FIELDS];
+        binding_t bindings[MAX_BINDINGS];
+        uint8_t num_bindings;
+        bool changed;
+        stats_t stats;
+
+        void render(binding_t& binding);
+};
+
+/*****************************************************************************/
+
+/* Include Guard Close */
+
+#endif /* UI_BINDER_H */
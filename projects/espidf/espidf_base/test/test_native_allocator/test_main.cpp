@@ -0,0 +1,159 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the LVGL tiered allocator, on the recorded LVGL
+ * allocations of a UI run.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Project Headers
+#include "memory/tiered_allocator.h"
+#include "native/native.h"
+#include "native/native_alloc_trace.h"
+#include "native/native_app.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Frames of the recorded UI run (idle and slider drag)
+static constexpr uint32_t TRACE_IDLE_FRAMES = 50U;
+static constexpr uint32_t TRACE_DRAG_FRAMES = 50U;
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// Tiered allocator to replay the LVGL allocations trace on
+static TieredAllocator ReplayAllocator;
+
+// Tiered allocator interface for the trace replay
+static const native_allocator_t TIERED_ALLOCATOR =
+{
+    "tiered",
+    [](size_t size) { return ReplayAllocator.malloc(size); },
+    [](void* ptr, size_t size) { return ReplayAllocator.realloc(ptr, size); },
+    [](void* ptr) { ReplayAllocator.free(ptr); }
+};
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{
+    ReplayAllocator.init();
+    ReplayAllocator.reset_stats();
+}
+
+void tearDown()
+{}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details The replayed blocks must keep their contents (also the moved
+ * part of reallocated ones), and all the memory must be returned at the
+ * end.
+ */
+static void test_replay_contents_and_release()
+{
+    double t_replay_s = 0.0;
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, native_alloc_trace_size());
+    TEST_ASSERT_TRUE(native_alloc_trace_replay(TIERED_ALLOCATOR, true,
+        t_replay_s));
+    for (uint8_t i = 0U; i < TieredAllocator::NUM_TIERS; i++)
+    {
+        const TieredAllocator::tier_t tier =
+            static_cast<TieredAllocator::tier_t>(i);
+        TEST_ASSERT_EQUAL_UINT32(0U, ReplayAllocator.get_tier_stats(tier).used);
+    }
+}
+
+/**
+ * @details LVGL small allocations must be served from the slabs.
+ */
+static void test_small_blocks_in_slabs()
+{
+    double t_replay_s = 0.0;
+    uint32_t slab_allocs = 0U;
+
+    native_alloc_trace_replay(TIERED_ALLOCATOR, false, t_replay_s);
+    for (uint8_t i = 0U; i < TieredAllocator::NUM_CLASSES; i++)
+    {
+        slab_allocs = slab_allocs +
+            ReplayAllocator.get_class_stats(i).allocs;
+    }
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, slab_allocs);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    // Record the LVGL allocations of a UI run
+    LvglAllocator.set_trace(native_alloc_trace_record);
+    native_app_init();
+    native_app_run_frames(TRACE_IDLE_FRAMES);
+    for (uint32_t frame = 0U; frame < TRACE_DRAG_FRAMES; frame++)
+    {
+        native_touch_press(NATIVE_SLIDER_X_START +
+            ((NATIVE_SLIDER_WIDTH * frame) / TRACE_DRAG_FRAMES),
+            NATIVE_SLIDER_Y);
+        native_app_run_frames(1U);
+    }
+    native_touch_release();
+    native_app_run_frames(1U);
+    LvglAllocator.set_trace(nullptr);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_replay_contents_and_release);
+    RUN_TEST(test_small_blocks_in_slabs);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
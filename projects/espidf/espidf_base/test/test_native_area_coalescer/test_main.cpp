@@ -0,0 +1,216 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the screen invalidated areas coalescer.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+#include <cstring>
+
+// Graphic Libraies
+#include <lvgl.h>
+
+// Project Headers
+#include "config/config_screen.h"
+#include "display/area_coalescer.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Invalidated areas of one frame.
+ */
+struct areas_pattern_t
+{
+    uint16_t num_areas;
+    lv_area_t areas[4];
+};
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Invalidation patterns of screen 1 (areas that LVGL invalidates on each
+// kind of UI update, after its own join of overlapping areas)
+static const areas_pattern_t SCREEN_1_PATTERNS[] =
+{
+    { 1U, { {144, 94, 335, 109} } },
+    { 3U, { {164, 171, 315, 186}, {112, 191, 247, 210},
+        {240, 191, 370, 210} } },
+    { 2U, { {172, 289, 307, 304}, {196, 225, 283, 259} } },
+    { 3U, { {144, 94, 335, 109}, {164, 171, 315, 186},
+        {172, 289, 307, 304} } },
+};
+
+// Address window costs (pixels) replayed on the invalidation patterns
+static const uint32_t WINDOW_COSTS_PX[] =
+    { 0U, 100U, ns_const::SCREEN_AREA_WINDOW_COST_PX, 2000U };
+
+// Two areas on the same rows with a gap between them: 100x10 and 90x10
+// pixels, 200x10 pixels bounding box (100 pixels more than both)
+static const lv_area_t GAP_AREAS[2] =
+    { {0, 0, 99, 9}, {110, 0, 199, 9} };
+static constexpr uint32_t GAP_AREAS_EXTRA_PX = 100U;
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{}
+
+void tearDown()
+{}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details Merging is only done when it saves bus cost, so on every screen
+ * 1 invalidation pattern and window cost the modeled bus cost (pixels and
+ * address windows) must never grow, nor the number of areas.
+ */
+static void test_bus_cost_never_grows()
+{
+    AreaCoalescer coalescer(0U);
+
+    for (const areas_pattern_t& pattern : SCREEN_1_PATTERNS)
+    {
+        for (uint32_t window_cost_px : WINDOW_COSTS_PX)
+        {
+            lv_area_t areas[4];
+            uint8_t joined[4] = {0U};
+
+            memcpy(areas, pattern.areas, sizeof(areas));
+            coalescer.set_window_cost(window_cost_px);
+            coalescer.reset();
+            uint16_t num_out = coalescer.coalesce(areas, joined,
+                pattern.num_areas);
+
+            const AreaCoalescer::stats_t& stats = coalescer.get_stats();
+            uint64_t cost_in = stats.px_in +
+                ((uint64_t)(stats.areas_in) * window_cost_px);
+            uint64_t cost_out = stats.px_out +
+                ((uint64_t)(stats.areas_out) * window_cost_px);
+            TEST_ASSERT_EQUAL_UINT32(pattern.num_areas, stats.areas_in);
+            TEST_ASSERT_EQUAL_UINT32(num_out, stats.areas_out);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(stats.areas_in, num_out);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT64(cost_in, cost_out);
+        }
+    }
+}
+
+/**
+ * @details Areas that overlap on the same rows (slider knob and its
+ * indicator) are merged even with no window cost, as their bounding box
+ * has less pixels than both of them.
+ */
+static void test_overlapping_areas_merged()
+{
+    AreaCoalescer coalescer(0U);
+    lv_area_t areas[4];
+    uint8_t joined[4] = {0U};
+
+    memcpy(areas, SCREEN_1_PATTERNS[1].areas, sizeof(areas));
+    uint16_t num_out = coalescer.coalesce(areas, joined,
+        SCREEN_1_PATTERNS[1].num_areas);
+
+    TEST_ASSERT_EQUAL_UINT32(2U, num_out);
+    TEST_ASSERT_EQUAL_UINT8(1U, joined[1]);
+    TEST_ASSERT_EQUAL_INT(112, areas[2].x1);
+    TEST_ASSERT_EQUAL_INT(370, areas[2].x2);
+}
+
+/**
+ * @details Two areas with a gap between them are merged only when the
+ * window cost is higher than the extra pixels of their bounding box, and
+ * merged into the last one (it keeps being the last to be drawn).
+ */
+static void test_gap_merged_by_window_cost()
+{
+    AreaCoalescer coalescer(GAP_AREAS_EXTRA_PX - 1U);
+    lv_area_t areas[2];
+    uint8_t joined[2] = {0U};
+
+    memcpy(areas, GAP_AREAS, sizeof(areas));
+    TEST_ASSERT_EQUAL_UINT32(2U, coalescer.coalesce(areas, joined, 2U));
+
+    coalescer.set_window_cost(GAP_AREAS_EXTRA_PX);
+    TEST_ASSERT_EQUAL_UINT32(1U, coalescer.coalesce(areas, joined, 2U));
+    TEST_ASSERT_EQUAL_UINT8(1U, joined[0]);
+    TEST_ASSERT_EQUAL_UINT8(0U, joined[1]);
+    TEST_ASSERT_EQUAL_INT(0, areas[1].x1);
+    TEST_ASSERT_EQUAL_INT(199, areas[1].x2);
+}
+
+/**
+ * @details Areas already joined by LVGL are skipped.
+ */
+static void test_joined_areas_skipped()
+{
+    AreaCoalescer coalescer(ns_const::SCREEN_AREA_WINDOW_COST_PX);
+    lv_area_t areas[2];
+    uint8_t joined[2] = {1U, 0U};
+
+    memcpy(areas, GAP_AREAS, sizeof(areas));
+    uint16_t num_out = coalescer.coalesce(areas, joined, 2U);
+
+    TEST_ASSERT_EQUAL_UINT32(1U, num_out);
+    TEST_ASSERT_EQUAL_UINT32(1U, coalescer.get_stats().areas_in);
+    TEST_ASSERT_EQUAL_INT(110, areas[1].x1);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_bus_cost_never_grows);
+    RUN_TEST(test_overlapping_areas_merged);
+    RUN_TEST(test_gap_merged_by_window_cost);
+    RUN_TEST(test_joined_areas_skipped);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,120 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the boot sequence: first frame and backlight.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// ESP-IDF Framework
+#include "driver/gpio.h"
+
+// Project Headers
+#include "config/config.h"
+#include "native/native_app.h"
+#include "profiler/boot_profiler.h"
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// Backlight state once the application startup is done, before the first
+// frame is sent
+static bool backlight_before_frame = false;
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{}
+
+void tearDown()
+{}
+
+/*****************************************************************************/
+
+/* Test Functions */
+
+static bool backlight_is_on()
+{
+    return (gpio_get_level(static_cast<gpio_num_t>(IO_LCD_BACKLIGHT)) != 0);
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details The first frame must be sent, with the backlight on.
+ */
+static void test_first_frame_sent()
+{
+    TEST_ASSERT_NOT_NULL(Boot.get_phase("first_frame"));
+    TEST_ASSERT_TRUE(backlight_is_on());
+}
+
+/**
+ * @details On fast boot the backlight must stay off until the first frame
+ * is sent (the screen is not cleared, the panel RAM garbage must not be
+ * shown).
+ */
+static void test_backlight_off_until_first_frame()
+{
+    if (ns_const::FAST_BOOT == false)
+    {   TEST_IGNORE_MESSAGE("Fast boot disabled");   }
+
+    TEST_ASSERT_FALSE(backlight_before_frame);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    native_app_init();
+    backlight_before_frame = backlight_is_on();
+    native_app_run_frames(1U);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_first_frame_sent);
+    RUN_TEST(test_backlight_off_until_first_frame);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,250 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the buzzer tones queue: beep timing, queued beeps
+ * and melodies.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Project Headers
+#include "config/config.h"
+#include "buzzer/melody.h"
+#include "native/native.h"
+#include "native/native_app.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Beep times checked by the beep timing test, offset of each beep start
+// from the main loop period, and max allowed beep time error
+static const uint16_t BEEP_TIMES_MS[] = { 1U, 20U, 37U, 100U, 250U };
+static constexpr uint32_t BEEP_START_OFFSET_US = 3300U;
+static constexpr uint32_t BEEP_MAX_ERROR_US = 0U;
+
+// Beeps burst (queued at once)
+static constexpr uint8_t BEEP_BURST_TONES = 8U;
+static constexpr uint16_t BEEP_BURST_TIME_MS = 30U;
+static constexpr uint16_t BEEP_BURST_GAP_MS = 20U;
+
+// Simulated clock step while a tones sequence plays
+static constexpr uint32_t SEQUENCE_STEP_US = 100U;
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{
+    // Wait for any previous beep to end
+    while (Buzzer.is_beeping())
+    {   native_time_advance_ms(NATIVE_FRAME_PERIOD_MS);   }
+}
+
+void tearDown()
+{}
+
+/*****************************************************************************/
+
+/* Test Functions */
+
+/**
+ * @details Plays the queued buzzer tones, returning the number of tones
+ * played (PWM switched on for each one) and the time from the first tone
+ * start to the last tone end.
+ */
+static uint32_t buzzer_sequence_run(uint32_t* time_us)
+{
+    native_pwm_state_t pwm_start = native_pwm_state(0U);
+    int64_t first_on_us = -1;
+
+    while (Buzzer.is_beeping())
+    {
+        native_time_advance_us(SEQUENCE_STEP_US);
+        native_pwm_state_t pwm = native_pwm_state(0U);
+        if ( (first_on_us < 0) && (pwm.on_edges != pwm_start.on_edges) )
+        {   first_on_us = pwm.on_us;   }
+    }
+    native_pwm_state_t pwm_end = native_pwm_state(0U);
+
+    *time_us = (uint32_t)(pwm_end.off_us - first_on_us);
+    return (pwm_end.on_edges - pwm_start.on_edges);
+}
+
+/**
+ * @details Number of tones of a melody (its notes, except the rests).
+ */
+static uint32_t melody_tones(const melody_t& melody)
+{
+    uint32_t tones = 0U;
+
+    for (uint8_t i = 0U; i < melody.num_notes; i++)
+    {
+        if (melody.notes[i].pitch != MELODY_REST)
+        {   tones = tones + 1U;   }
+    }
+    return tones;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details Beeps start at some offset from the frame period, and only the
+ * frame period passes (the buzzer is not polled), so the beep end depends
+ * only on the buzzer timer. Beep time error is measured from the PWM
+ * output edges on the simulated clock.
+ */
+static void test_beep_timing()
+{
+    for (uint16_t beep_time_ms : BEEP_TIMES_MS)
+    {
+        native_time_advance_us(BEEP_START_OFFSET_US);
+        Buzzer.beep(ns_const::BUZZER_MAX_FREQ_HZ, beep_time_ms);
+        while (Buzzer.is_beeping())
+        {   native_time_advance_ms(NATIVE_FRAME_PERIOD_MS);   }
+
+        native_pwm_state_t pwm = native_pwm_state(0U);
+        int64_t time_us = pwm.off_us - pwm.on_us;
+        int64_t diff_us = time_us - (static_cast<int64_t>(beep_time_ms) *
+            1000LL);
+        uint32_t error_us = (uint32_t)((diff_us < 0) ? -diff_us : diff_us);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(BEEP_MAX_ERROR_US, error_us);
+    }
+}
+
+/**
+ * @details Beeps queued at once must all be played (no tone dropped), with
+ * their gaps between them.
+ */
+static void test_beeps_burst()
+{
+    uint32_t time_us = 0U;
+
+    for (uint8_t i = 0U; i < BEEP_BURST_TONES; i++)
+    {
+        Buzzer.beep(ns_const::BUZZER_MIN_FREQ_HZ + (i * 100U),
+            BEEP_BURST_TIME_MS, BEEP_BURST_GAP_MS);
+    }
+    uint32_t tones = buzzer_sequence_run(&time_us);
+
+    TEST_ASSERT_EQUAL_UINT32(BEEP_BURST_TONES, tones);
+    TEST_ASSERT_EQUAL_UINT32((BEEP_BURST_TONES * (BEEP_BURST_TIME_MS +
+        BEEP_BURST_GAP_MS) - BEEP_BURST_GAP_MS) * 1000U, time_us);
+}
+
+/**
+ * @details The alarm melody must play all its notes (rests are silent),
+ * for the melody duration.
+ */
+static void test_alarm_melody()
+{
+    uint32_t time_us = 0U;
+
+    Buzzer.play(&MELODY_ALARM);
+    uint32_t tones = buzzer_sequence_run(&time_us);
+
+    TEST_ASSERT_EQUAL_UINT32(melody_tones(MELODY_ALARM), tones);
+    TEST_ASSERT_EQUAL_UINT32((melody_get_duration_ms(MELODY_ALARM) -
+        MELODY_ALARM.gap_ms) * 1000U, time_us);
+}
+
+/**
+ * @details At the end of boot, the startup melody request must reach the
+ * UI task and play all the melody notes.
+ */
+static void test_startup_melody()
+{
+    uint32_t time_us = 0U;
+    native_pwm_state_t pwm_start = native_pwm_state(0U);
+
+    TEST_ASSERT_TRUE(buzzer_startup_melody());
+    native_app_run_frames(1U);
+    TEST_ASSERT_TRUE(Buzzer.is_beeping());
+    buzzer_sequence_run(&time_us);
+
+    TEST_ASSERT_EQUAL_UINT32(melody_tones(MELODY_STARTUP),
+        native_pwm_state(0U).on_edges - pwm_start.on_edges);
+}
+
+/**
+ * @details A beep requested from an ISR must be forwarded to the UI task
+ * (the only tones queue producer), waking it up, and played from it.
+ */
+static void test_beep_from_isr()
+{
+    native_pwm_state_t pwm_start = native_pwm_state(0U);
+
+    TEST_ASSERT_TRUE(buzzer_request_beep_from_isr(
+        ns_const::BUZZER_MAX_FREQ_HZ, BEEP_BURST_TIME_MS));
+    TEST_ASSERT_FALSE(Buzzer.is_beeping());
+    native_app_run_frames(1U);
+    TEST_ASSERT_TRUE(Buzzer.is_beeping());
+    while (Buzzer.is_beeping())
+    {   native_time_advance_ms(NATIVE_FRAME_PERIOD_MS);   }
+
+    native_pwm_state_t pwm = native_pwm_state(0U);
+    int64_t diff_us = (pwm.off_us - pwm.on_us) -
+        (static_cast<int64_t>(BEEP_BURST_TIME_MS) * 1000LL);
+    uint32_t error_us = (uint32_t)((diff_us < 0) ? -diff_us : diff_us);
+    TEST_ASSERT_EQUAL_UINT32(1U, pwm.on_edges - pwm_start.on_edges);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(BEEP_MAX_ERROR_US, error_us);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    native_app_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_beep_timing);
+    RUN_TEST(test_beeps_burst);
+    RUN_TEST(test_alarm_melody);
+    RUN_TEST(test_startup_melody);
+    RUN_TEST(test_beep_from_isr);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
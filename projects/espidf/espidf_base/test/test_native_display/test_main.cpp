@@ -0,0 +1,360 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the display flush: render and DMA transfer
+ * overlap.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// ESP-IDF Framework
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+// Graphic Libraies
+#include <lvgl.h>
+
+// Project Headers
+#include "config/config_screen.h"
+#include "native/native.h"
+#include "native/native_app.h"
+
+/*****************************************************************************/
+
+/* Data Types */
+
+/**
+ * @brief Flushed area: its render start, DMA transfer and buffer release
+ * (lv_disp_flush_ready()) times on the simulated clock, -1 if not seen.
+ */
+struct area_flush_t
+{
+    int64_t render_us;
+    int64_t dma_start_us;
+    int64_t dma_end_us;
+    int64_t ready_us;
+};
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Max number of flushed areas recorded
+static constexpr uint32_t MAX_FLUSHES = 64U;
+
+// Bytes of a full screen render buffer
+static constexpr size_t FULL_SCREEN_BYTES = ns_const::SCREEN_WIDTH *
+    ns_const::SCREEN_HEIGHT * sizeof(lv_color_t);
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// Display driver, and its callbacks wrapped by the test ones
+static lv_disp_drv_t* disp_drv = nullptr;
+static void (*app_flush_cb)(lv_disp_drv_t*, const lv_area_t*,
+    lv_color_t*) = nullptr;
+static void (*app_wait_cb)(lv_disp_drv_t*) = nullptr;
+static void (*app_init_buf)(lv_draw_ctx_t*) = nullptr;
+
+// Recorded flushed areas, and render start time of the area being drawn
+static area_flush_t flushes[MAX_FLUSHES];
+static uint32_t num_flushes = 0U;
+static int64_t render_start_us = -1;
+
+/*****************************************************************************/
+
+/* Test Functions */
+
+/**
+ * @details Records the buffer release of the last flushed area when LVGL
+ * sees it released (the render buffer no longer flushing).
+ */
+static void flush_ready_check()
+{
+    if (num_flushes == 0U)
+    {   return;   }
+    area_flush_t& flush = flushes[num_flushes - 1U];
+    if ( (flush.ready_us < 0) && (disp_drv->draw_buf->flushing == 0) )
+    {   flush.ready_us = esp_timer_get_time();   }
+}
+
+/**
+ * @details Called by LVGL before drawing each area into a render buffer.
+ */
+static void test_init_buf(lv_draw_ctx_t* draw_ctx)
+{
+    render_start_us = esp_timer_get_time();
+    if (app_init_buf != nullptr)
+    {   app_init_buf(draw_ctx);   }
+}
+
+static void test_flush_cb(lv_disp_drv_t* drv, const lv_area_t* area,
+    lv_color_t* color_p)
+{
+    app_flush_cb(drv, area, color_p);
+    if (num_flushes >= MAX_FLUSHES)
+    {   return;   }
+
+    area_flush_t& flush = flushes[num_flushes];
+    flush.render_us = render_start_us;
+    flush.dma_start_us = Screen.dma_last().start_us;
+    flush.dma_end_us = Screen.dma_last().end_us;
+    flush.ready_us = -1;
+    num_flushes = num_flushes + 1U;
+    flush_ready_check();
+}
+
+static void test_wait_cb(lv_disp_drv_t* drv)
+{
+    app_wait_cb(drv);
+    flush_ready_check();
+}
+
+/**
+ * @details Redraws the whole screen (several areas, one per render
+ * buffer) and waits for its transfers to end.
+ */
+static void screen_redraw()
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    flush_ready_check();
+    display_flush_wait_all();
+    flush_ready_check();
+}
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{
+    disp_drv = lv_disp_get_default()->driver;
+    app_flush_cb = disp_drv->flush_cb;
+    app_wait_cb = disp_drv->wait_cb;
+    app_init_buf = disp_drv->draw_ctx->init_buf;
+    disp_drv->flush_cb = test_flush_cb;
+    disp_drv->wait_cb = test_wait_cb;
+    disp_drv->draw_ctx->init_buf = test_init_buf;
+    num_flushes = 0U;
+    render_start_us = -1;
+}
+
+void tearDown()
+{
+    disp_drv->flush_cb = app_flush_cb;
+    disp_drv->wait_cb = app_wait_cb;
+    disp_drv->draw_ctx->init_buf = app_init_buf;
+    native_heap_set_free(MALLOC_CAP_INTERNAL, SIZE_MAX);
+    native_heap_set_free(MALLOC_CAP_SPIRAM, SIZE_MAX);
+    display_set_buffer_strategy(ns_const::SCREEN_BUFFER_STRATEGY);
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details With double render buffers, LVGL must render the next area
+ * while the previous one is being sent by DMA (the flush callback only
+ * launches the transfer).
+ */
+static void test_render_overlaps_dma()
+{
+    uint32_t dma_calls_start = Screen.stats().dma_write_calls;
+
+    screen_redraw();
+
+    TEST_ASSERT_GREATER_THAN_UINT32(1U, num_flushes);
+    TEST_ASSERT_EQUAL_UINT32(num_flushes,
+        Screen.stats().dma_write_calls - dma_calls_start);
+    for (uint32_t i = 1U; i < num_flushes; i++)
+    {
+        TEST_ASSERT_GREATER_OR_EQUAL_INT64(0, flushes[i].render_us);
+        TEST_ASSERT_LESS_THAN_INT64(flushes[i - 1U].dma_end_us,
+            flushes[i].render_us);
+    }
+}
+
+/**
+ * @details A render buffer must only be released to LVGL
+ * (lv_disp_flush_ready()) once its DMA transfer is done (dmaBusy() false).
+ */
+static void test_flush_ready_after_dma()
+{
+    screen_redraw();
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, num_flushes);
+    for (uint32_t i = 0U; i < num_flushes; i++)
+    {
+        TEST_ASSERT_GREATER_OR_EQUAL_INT64(0, flushes[i].ready_us);
+        TEST_ASSERT_GREATER_OR_EQUAL_INT64(flushes[i].dma_end_us,
+            flushes[i].ready_us);
+    }
+}
+
+/**
+ * @details With DMA flushes, the profiled frame must last until its last
+ * transfer ends, and its flush time must include the transfers time (not
+ * only their launch).
+ */
+static void test_profiler_frame_includes_dma()
+{
+    uint32_t dma_us = 0U;
+
+    Profiler.reset();
+    screen_redraw();
+
+    const FrameProfiler::frame_t* frame = Profiler.last_frame();
+    TEST_ASSERT_NOT_NULL(frame);
+    TEST_ASSERT_GREATER_THAN_UINT32(1U, num_flushes);
+    for (uint32_t i = 0U; i < num_flushes; i++)
+    {
+        dma_us = dma_us +
+            (uint32_t)(flushes[i].dma_end_us - flushes[i].dma_start_us);
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(dma_us, frame->flush_us);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT64(
+        flushes[num_flushes - 1U].dma_end_us - flushes[0].render_us,
+        (int64_t)(frame->frame_us));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(ns_const::SCREEN_WIDTH) *
+        ns_const::SCREEN_HEIGHT, frame->area_px);
+}
+
+/**
+ * @details Without memory for the new render buffers nor for the fallback
+ * ones, the current buffers must be kept in use (not released).
+ */
+static void test_buffers_kept_without_memory()
+{
+    TEST_ASSERT_TRUE(display_set_buffer_strategy(
+        SCREEN_BUFFER_INTERNAL_DOUBLE));
+    native_heap_set_free(MALLOC_CAP_INTERNAL, 0U);
+    native_heap_set_free(MALLOC_CAP_SPIRAM, 0U);
+
+    TEST_ASSERT_FALSE(display_set_buffer_strategy(SCREEN_BUFFER_PSRAM_FULL));
+    TEST_ASSERT_EQUAL(SCREEN_BUFFER_INTERNAL_DOUBLE, buffer_strategy);
+
+    native_heap_set_free(MALLOC_CAP_INTERNAL, SIZE_MAX);
+    native_heap_set_free(MALLOC_CAP_SPIRAM, SIZE_MAX);
+    screen_redraw();
+    TEST_ASSERT_GREATER_THAN_UINT32(1U, num_flushes);
+}
+
+/**
+ * @details Without memory for the new render buffers, the display must
+ * fall back to the SCREEN_BUFFER_INTERNAL_SINGLE ones (not the caller).
+ */
+static void test_buffers_fallback_internal_single()
+{
+    TEST_ASSERT_TRUE(display_set_buffer_strategy(
+        SCREEN_BUFFER_INTERNAL_DOUBLE));
+    native_heap_set_free(MALLOC_CAP_SPIRAM, 0U);
+
+    TEST_ASSERT_FALSE(display_set_buffer_strategy(SCREEN_BUFFER_PSRAM_FULL));
+    TEST_ASSERT_EQUAL(SCREEN_BUFFER_INTERNAL_SINGLE, buffer_strategy);
+
+    screen_redraw();
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, num_flushes);
+}
+
+/**
+ * @details If the new render buffers only fit once the current ones are
+ * released, they must be allocated after moving to the fallback ones, and
+ * the fallback ones released afterwards.
+ */
+static void test_buffers_retry_after_fallback()
+{
+    TEST_ASSERT_TRUE(display_set_buffer_strategy(SCREEN_BUFFER_PSRAM_FULL));
+    size_t internal_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    native_heap_set_free(MALLOC_CAP_SPIRAM, FULL_SCREEN_BYTES - 1U);
+
+    TEST_ASSERT_TRUE(display_set_buffer_strategy(SCREEN_BUFFER_PSRAM_FULL));
+    TEST_ASSERT_EQUAL(SCREEN_BUFFER_PSRAM_FULL, buffer_strategy);
+    TEST_ASSERT_EQUAL_UINT32(internal_free,
+        heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+
+    screen_redraw();
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, num_flushes);
+}
+
+/**
+ * @details The screen buffers benchmark must never leave LVGL without
+ * buffers (or with released ones), even without memory for any strategy.
+ */
+static void test_benchmark_without_memory()
+{
+    TEST_ASSERT_TRUE(display_set_buffer_strategy(
+        SCREEN_BUFFER_INTERNAL_DOUBLE));
+    native_heap_set_free(MALLOC_CAP_INTERNAL, 0U);
+    native_heap_set_free(MALLOC_CAP_SPIRAM, 0U);
+
+    display_benchmark();
+    TEST_ASSERT_EQUAL(SCREEN_BUFFER_INTERNAL_DOUBLE, buffer_strategy);
+
+    native_heap_set_free(MALLOC_CAP_INTERNAL, SIZE_MAX);
+    native_heap_set_free(MALLOC_CAP_SPIRAM, SIZE_MAX);
+    screen_redraw();
+    TEST_ASSERT_GREATER_THAN_UINT32(1U, num_flushes);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    native_app_init();
+    native_app_run_frames(1U);
+    display_flush_wait_all();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_render_overlaps_dma);
+    RUN_TEST(test_flush_ready_after_dma);
+    RUN_TEST(test_profiler_frame_includes_dma);
+    RUN_TEST(test_buffers_kept_without_memory);
+    RUN_TEST(test_buffers_fallback_internal_single);
+    RUN_TEST(test_buffers_retry_after_fallback);
+    RUN_TEST(test_benchmark_without_memory);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
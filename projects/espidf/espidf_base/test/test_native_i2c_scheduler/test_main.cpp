@@ -0,0 +1,281 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the Touch Panel reads through the I2C Bus
+ * Scheduler: I2C frequency probe, heap usage and bus faults latency.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+#include <cstring>
+
+// ESP-IDF Framework
+#include "esp_timer.h"
+
+// Project Headers
+#include "config/config.h"
+#include "controller/i2c/i2c.h"
+#include "controller/i2c/i2c_scheduler.h"
+#include "native/native.h"
+#include "native/native_app.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Number of touch samples read on each I2C frequency, and the frequencies
+static constexpr uint32_t TOUCH_SPEED_SAMPLES = 100U;
+static const uint32_t TOUCH_I2C_FREQUENCIES_HZ[] =
+    { 100000UL, 400000UL, 1000000UL };
+
+// Touch Panel sample registers (TD_STATUS to YL)
+static constexpr uint8_t TOUCH_REG_TD_STATUS = 0x02U;
+static constexpr uint8_t TOUCH_SAMPLE_NUM_REGS = 5U;
+
+// Number of touch samples read by the touch heap test
+static constexpr uint32_t TOUCH_HEAP_SAMPLES = 100U;
+
+// Number of touch samples read with a faulty touch panel, and max allowed
+// time blocked on each one
+static constexpr uint32_t TOUCH_FAULT_SAMPLES = 100U;
+static constexpr uint32_t TOUCH_FAULT_MAX_LATENCY_US = 50000U;
+
+// Time for the circuit breaker backoff to expire once a fault is gone
+static constexpr uint32_t TOUCH_FAULT_RECOVERY_MS = 5000U;
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{}
+
+void tearDown()
+{
+    native_i2c_set_fault(NATIVE_I2C_FAULT_NONE);
+    native_i2c_set_install_fail(false);
+    native_touch_release();
+}
+
+/*****************************************************************************/
+
+/* Test Functions */
+
+/**
+ * @details Reads the Touch Panel sample registers through the I2C Scheduler
+ * at the given frequency (set in the request device).
+ */
+static bool touch_read_regs(const uint32_t frequency,
+    uint8_t regs[TOUCH_SAMPLE_NUM_REGS])
+{
+    i2c_device_t device = { FT6236<TouchI2C>::I2C_ADDRESS,
+        I2C_PRIORITY_TOUCH, ns_const::TOUCH_I2C_DEADLINE_MS, frequency };
+    return (I2CBus.read_registers_sync(device, TOUCH_REG_TD_STATUS, regs,
+        TOUCH_SAMPLE_NUM_REGS) == I2C_RESULT_OK);
+}
+
+/**
+ * @details Runs touch sampling with a faulty touch panel, returning the
+ * max time blocked on a sample, and if touch works again once the fault
+ * is gone.
+ */
+static uint32_t touch_fault_run(const native_i2c_fault_t fault,
+    bool* recovered)
+{
+    uint32_t max_latency_us = 0U;
+    int pos[2];
+
+    I2CBus.reset_stats();
+    native_i2c_set_fault(fault);
+    native_touch_press(NATIVE_BUTTON_X, NATIVE_BUTTON_Y);
+    for (uint32_t i = 0U; i < TOUCH_FAULT_SAMPLES; i++)
+    {
+        native_time_advance_ms(ns_const::TOUCH_READ_PERIOD_MS);
+        int64_t t0 = esp_timer_get_time();
+        manage_touch();
+        uint32_t latency_us = (uint32_t)(esp_timer_get_time() - t0);
+        if (latency_us > max_latency_us)
+        {   max_latency_us = latency_us;   }
+    }
+
+    native_i2c_set_fault(NATIVE_I2C_FAULT_NONE);
+    native_time_advance_ms(TOUCH_FAULT_RECOVERY_MS);
+    TouchPanel.get_position(pos);
+    *recovered = (pos[0] >= 0);
+    return max_latency_us;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details The frequency probed at touch_init() must be the fastest one
+ * that reads the touch position right.
+ */
+static void test_probe_chooses_fastest_right_frequency()
+{
+    uint32_t fastest_valid = 0U;
+    uint8_t regs_ref[TOUCH_SAMPLE_NUM_REGS];
+    uint8_t regs[TOUCH_SAMPLE_NUM_REGS];
+
+    native_touch_press(NATIVE_BUTTON_X, NATIVE_BUTTON_Y);
+    TEST_ASSERT_TRUE(touch_read_regs(ns_const::I2C_FREQUENCY_HZ, regs_ref));
+    for (uint32_t frequency : TOUCH_I2C_FREQUENCIES_HZ)
+    {
+        uint32_t valid = 0U;
+
+        for (uint32_t i = 0U; i < TOUCH_SPEED_SAMPLES; i++)
+        {
+            if ( touch_read_regs(frequency, regs) &&
+                 (memcmp(regs, regs_ref, TOUCH_SAMPLE_NUM_REGS) == 0) )
+            {   valid = valid + 1U;   }
+        }
+        if (valid == TOUCH_SPEED_SAMPLES)
+        {   fastest_valid = frequency;   }
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(0x01U, regs_ref[0]);
+    TEST_ASSERT_EQUAL_UINT32(fastest_valid, TouchI2C::get_frequency());
+}
+
+/**
+ * @details Touch is sampled tens of times per second for the whole uptime,
+ * so reading a sample (I2C transaction included) must not use the heap.
+ */
+static void test_touch_read_no_heap()
+{
+    native_heap_stats_t heap_start = native_heap_stats();
+    for (uint32_t i = 0U; i < TOUCH_HEAP_SAMPLES; i++)
+    {
+        native_touch_press(NATIVE_SLIDER_X_START + (i % NATIVE_SLIDER_WIDTH),
+            NATIVE_SLIDER_Y);
+        native_time_advance_ms(ns_const::TOUCH_READ_PERIOD_MS);
+        manage_touch();
+    }
+    native_heap_stats_t heap_end = native_heap_stats();
+
+    TEST_ASSERT_EQUAL_UINT32(0U, heap_end.allocs - heap_start.allocs);
+}
+
+/**
+ * @details A touch panel that NACKs must not block the touch sampling (and
+ * so the UI) for longer than a bounded time, and touch must work again
+ * once the fault is gone.
+ */
+static void test_fault_nack_latency()
+{
+    bool recovered = false;
+    uint32_t max_latency_us = touch_fault_run(NATIVE_I2C_FAULT_NACK,
+        &recovered);
+
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TOUCH_FAULT_MAX_LATENCY_US,
+        max_latency_us);
+    TEST_ASSERT_TRUE(recovered);
+}
+
+/**
+ * @details A touch panel that holds SDA low must not block the touch
+ * sampling for longer than a bounded time, and touch must work again once
+ * the fault is gone (bus recovered).
+ */
+static void test_fault_stuck_sda_latency()
+{
+    bool recovered = false;
+    uint32_t max_latency_us = touch_fault_run(NATIVE_I2C_FAULT_STUCK_SDA,
+        &recovered);
+
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TOUCH_FAULT_MAX_LATENCY_US,
+        max_latency_us);
+    TEST_ASSERT_TRUE(recovered);
+}
+
+/**
+ * @details A bus recovery that can't set up the I2C driver again must not
+ * abort: the touch panel is kept in backoff (its requests don't reach the
+ * bus) and works again once the driver can be set up.
+ */
+static void test_fault_recovery_install_fail()
+{
+    int pos[2];
+
+    I2CBus.reset_stats();
+    native_touch_press(NATIVE_BUTTON_X, NATIVE_BUTTON_Y);
+    native_i2c_set_install_fail(true);
+    native_i2c_set_fault(NATIVE_I2C_FAULT_STUCK_SDA);
+    TouchPanel.get_position(pos);
+    native_i2c_set_fault(NATIVE_I2C_FAULT_NONE);
+    TEST_ASSERT_EQUAL_INT(-1, pos[0]);
+    TEST_ASSERT_FALSE(i2c_bus_is_ready(I2C_PORT_TOUCH));
+
+    native_i2c_stats_reset();
+    for (uint32_t i = 0U; i < TOUCH_FAULT_SAMPLES; i++)
+    {
+        native_time_advance_ms(ns_const::TOUCH_READ_PERIOD_MS);
+        TouchPanel.get_position(pos);
+        TEST_ASSERT_EQUAL_INT(-1, pos[0]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, native_i2c_stats().transactions);
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, I2CBus.get_stats().backoff);
+
+    native_i2c_set_install_fail(false);
+    native_time_advance_ms(TOUCH_FAULT_RECOVERY_MS);
+    TouchPanel.get_position(pos);
+    TEST_ASSERT_TRUE(i2c_bus_is_ready(I2C_PORT_TOUCH));
+    TEST_ASSERT_GREATER_OR_EQUAL_INT(0, pos[0]);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    native_app_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_probe_chooses_fastest_right_frequency);
+    RUN_TEST(test_touch_read_no_heap);
+    RUN_TEST(test_fault_nack_latency);
+    RUN_TEST(test_fault_stuck_sda_latency);
+    RUN_TEST(test_fault_recovery_install_fail);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
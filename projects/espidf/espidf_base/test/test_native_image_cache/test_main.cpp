@@ -0,0 +1,197 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the LVGL decoded images cache: byte budget, LRU
+ * eviction and pinned images.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+#include <cstring>
+
+// Graphic Libraies
+#include <lvgl.h>
+
+// Project Headers
+#include "config/config_screen.h"
+#include "display/image_cache.h"
+#include "native/native_app.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Icons (alpha 4-bit, decoded line by line), number of sources, objects
+// showing each one and redrawn frames
+static constexpr lv_coord_t ICON_PX = 32;
+static constexpr uint8_t ICON_SOURCES = 4U;
+static constexpr uint8_t ICON_COPIES = 3U;
+static constexpr uint32_t REDRAW_FRAMES = 20U;
+
+// Decoded icon size
+static constexpr size_t ICON_BYTES =
+    (size_t)(ICON_PX) * ICON_PX * LV_IMG_PX_SIZE_ALPHA_BYTE;
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// Icons image data and descriptors
+static uint8_t icon_data[(ICON_PX * ICON_PX) / 2];
+static lv_img_dsc_t icons[ICON_SOURCES];
+
+// Row of icons, grouped by source
+static lv_obj_t* row = nullptr;
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{
+    for (size_t i = 0U; i < sizeof(icon_data); i++)
+    {   icon_data[i] = (uint8_t)(i * 37U);   }
+    for (lv_img_dsc_t& icon : icons)
+    {
+        memset(&icon, 0, sizeof(lv_img_dsc_t));
+        icon.header.cf = LV_IMG_CF_ALPHA_4BIT;
+        icon.header.w = ICON_PX;
+        icon.header.h = ICON_PX;
+        icon.data_size = sizeof(icon_data);
+        icon.data = icon_data;
+    }
+
+    row = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(row);
+    lv_obj_set_size(row, ICON_SOURCES * ICON_COPIES * ICON_PX, ICON_PX);
+    lv_obj_set_pos(row, 0, 0);
+    for (uint8_t i = 0U; i < ICON_SOURCES * ICON_COPIES; i++)
+    {
+        lv_obj_t* img = lv_img_create(row);
+        lv_img_set_src(img, &icons[i / ICON_COPIES]);
+        lv_obj_set_pos(img, i * ICON_PX, 0);
+    }
+    ImgCache.invalidate(nullptr);
+    ImgCache.pin(&icons[0]);
+}
+
+void tearDown()
+{
+    ImgCache.unpin(&icons[0]);
+    ImgCache.invalidate(nullptr);
+    ImgCache.set_budget(ns_const::SCREEN_IMG_CACHE_BUDGET_BYTES);
+    ImgCache.reset_stats();
+    lv_obj_del(row);
+    row = nullptr;
+    lv_refr_now(NULL);
+    display_flush_wait_all();
+}
+
+/*****************************************************************************/
+
+/* Test Functions */
+
+/**
+ * @details Redraws the row of icons the frames with a cache budget,
+ * returning the cache statistics of it.
+ */
+static ImageCache::stats_t icons_redraw(const size_t budget)
+{
+    ImgCache.set_budget(budget);
+    ImgCache.reset_stats();
+    for (uint32_t frame = 0U; frame < REDRAW_FRAMES; frame++)
+    {
+        lv_obj_invalidate(row);
+        lv_refr_now(NULL);
+    }
+    display_flush_wait_all();
+    return ImgCache.get_stats();
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details With budget for all the icons, each one is decoded once and
+ * nothing is evicted, and without budget (only the last decoded image is
+ * kept) the icons are decoded again.
+ */
+static void test_budget_for_all_icons()
+{
+    ImageCache::stats_t uncached = icons_redraw(0U);
+    ImgCache.invalidate(nullptr);
+    ImageCache::stats_t cached = icons_redraw(ICON_SOURCES * ICON_BYTES);
+
+    TEST_ASSERT_EQUAL_UINT32(ICON_SOURCES, cached.misses);
+    TEST_ASSERT_EQUAL_UINT32(0U, cached.evictions);
+    TEST_ASSERT_EQUAL_UINT32(ICON_SOURCES * ICON_BYTES, cached.bytes_max);
+    TEST_ASSERT_GREATER_THAN_UINT32(cached.misses, uncached.misses);
+}
+
+/**
+ * @details With budget for only two icons, the pinned icon must never be
+ * decoded again, and the other ones are evicted to fit.
+ */
+static void test_budget_for_two_icons()
+{
+    icons_redraw(ICON_SOURCES * ICON_BYTES);
+    ImageCache::stats_t small = icons_redraw(2U * ICON_BYTES);
+
+    TEST_ASSERT_EQUAL_UINT32((ICON_SOURCES - 1U) * REDRAW_FRAMES,
+        small.misses);
+    TEST_ASSERT_EQUAL_UINT32(small.misses, small.evictions);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2U * ICON_BYTES, small.bytes_max);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    native_app_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_budget_for_all_icons);
+    RUN_TEST(test_budget_for_two_icons);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,138 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the asynchronous logger: log records ring and
+ * per module level filter.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Project Headers
+#include "logger/logger.h"
+#include "logger/log_formats.h"
+#include "logger/log_ring.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Records pushed beyond the ring capacity
+static constexpr uint16_t LOG_OVERFLOW_RECORDS = 8U;
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{}
+
+void tearDown()
+{}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details Fills the log records ring beyond its capacity: the extra
+ * records must be dropped, and the stored ones read back in order and
+ * intact.
+ */
+static void test_ring_overflow()
+{
+    static LogRing ring;
+    log_record_t record;
+    uint32_t pushed = 0U;
+    uint32_t popped = 0U;
+
+    for (uint16_t i = 0U; i < LogRing::CAPACITY + LOG_OVERFLOW_RECORDS; i++)
+    {
+        record.timestamp_ms = i;
+        record.format_id = LOG_TOUCH_POSITION;
+        record.args[0] = i;
+        record.args[1] = -static_cast<int32_t>(i);
+        record.args[2] = 0;
+        if (ring.push(record))
+        {   pushed = pushed + 1U;   }
+    }
+    while (ring.pop(record))
+    {
+        TEST_ASSERT_EQUAL_INT32(static_cast<int32_t>(popped),
+            record.args[0]);
+        TEST_ASSERT_EQUAL_INT32(-static_cast<int32_t>(popped),
+            record.args[1]);
+        popped = popped + 1U;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(LogRing::CAPACITY, pushed);
+    TEST_ASSERT_EQUAL_UINT32(pushed, popped);
+    TEST_ASSERT_EQUAL_UINT32(0U, ring.get_size());
+}
+
+/**
+ * @details With the touch module below its messages level, touch messages
+ * are filtered out while the main module keeps logging.
+ */
+static void test_level_filter()
+{
+    AsyncLogger logger(LOG_FORMATS, LOG_NUM_FORMATS, LOG_LEVEL_INFO);
+
+    logger.set_level(LOG_MODULE_TOUCH, LOG_LEVEL_WARN);
+    TEST_ASSERT_FALSE(logger.log(LOG_TOUCH_POSITION, 1, 2));
+    TEST_ASSERT_TRUE(logger.log(LOG_UPTIME, 0));
+
+    AsyncLogger::stats_t stats = logger.get_stats();
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.written);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.filtered);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_ring_overflow);
+    RUN_TEST(test_level_filter);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,215 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the LEDC PWM channels and timers allocator.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// ESP-IDF Framework
+#include "controller/pwm/pwm.h"
+
+// Project Headers
+#include "config/config.h"
+#include "native/native.h"
+#include "native/native_app.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Number of buzzer frequencies beeped by the frequency sweep test
+static constexpr uint32_t PWM_SWEEP_STEPS = 50U;
+
+// Maximum number of LEDC timers (2 groups of 4)
+static constexpr uint8_t PWM_MAX_TIMERS = 8U;
+
+// Dimming outputs frequency and resolution
+static constexpr uint32_t PWM_DIM_FREQ_HZ = 5000U;
+static constexpr uint8_t PWM_DIM_RESOLUTION = 8U;
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{}
+
+void tearDown()
+{}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details Beeps a sweep of the buzzer frequencies (as dragging the
+ * frequency slider does), each frequency change must only update the
+ * buzzer LEDC timer frequency, without a full timer configuration.
+ */
+static void test_frequency_sweep_no_timer_config()
+{
+    using namespace ns_const;
+
+    uint32_t freq_step = (BUZZER_MAX_FREQ_HZ - BUZZER_MIN_FREQ_HZ) /
+        PWM_SWEEP_STEPS;
+    native_ledc_stats_t stats_start = native_ledc_stats();
+
+    for (uint32_t i = 0U; i < PWM_SWEEP_STEPS; i++)
+    {
+        Buzzer.beep(BUZZER_MIN_FREQ_HZ + ((i + 1U) * freq_step), 5U);
+        while (Buzzer.is_beeping())
+        {   native_time_advance_ms(1U);   }
+    }
+    native_ledc_stats_t stats_end = native_ledc_stats();
+
+    TEST_ASSERT_EQUAL_UINT32(0U,
+        stats_end.timer_configs - stats_start.timer_configs);
+    TEST_ASSERT_EQUAL_UINT32(PWM_SWEEP_STEPS,
+        stats_end.freq_changes - stats_start.freq_changes);
+}
+
+/**
+ * @details Two outputs at the same frequency and resolution (i.e.
+ * backlight dimming) must share a timer, that rejects frequency changes.
+ */
+static void test_shared_timer()
+{
+    ledc_usage_t usage_start = ledc_get_usage();
+
+    int8_t dim_a = ledc_alloc(LEDC_ANY_CHANNEL, LEDC_NO_PIN,
+        PWM_DIM_FREQ_HZ, PWM_DIM_RESOLUTION, false);
+    int8_t dim_b = ledc_alloc(LEDC_ANY_CHANNEL, LEDC_NO_PIN,
+        PWM_DIM_FREQ_HZ, PWM_DIM_RESOLUTION, false);
+    ledc_usage_t usage_shared = ledc_get_usage();
+    uint32_t changed_freq = ledc_change_frequency(dim_a, 1000U);
+    ledc_free(dim_a);
+    ledc_free(dim_b);
+
+    TEST_ASSERT_GREATER_OR_EQUAL_INT(0, dim_a);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT(0, dim_b);
+    TEST_ASSERT_EQUAL_UINT(usage_start.timers_used + 1U,
+        usage_shared.timers_used);
+    TEST_ASSERT_EQUAL_UINT32(0U, changed_freq);
+}
+
+/**
+ * @details The buzzer PWM channel (channel 0) is in use, it can't be
+ * taken by another output.
+ */
+static void test_channel_in_use_rejected()
+{
+    TEST_ASSERT_LESS_THAN_INT(0, ledc_alloc(0, LEDC_NO_PIN,
+        PWM_DIM_FREQ_HZ, PWM_DIM_RESOLUTION, false));
+}
+
+/**
+ * @details Channels out of range (negative other than LEDC_ANY_CHANNEL, or
+ * beyond the last one) are rejected without taking anything.
+ */
+static void test_invalid_channel_rejected()
+{
+    ledc_usage_t usage_start = ledc_get_usage();
+
+    TEST_ASSERT_LESS_THAN_INT(0, ledc_alloc(-2, LEDC_NO_PIN,
+        PWM_DIM_FREQ_HZ, PWM_DIM_RESOLUTION, false));
+    TEST_ASSERT_LESS_THAN_INT(0, ledc_alloc(INT8_MIN, LEDC_NO_PIN,
+        PWM_DIM_FREQ_HZ, PWM_DIM_RESOLUTION, false));
+    TEST_ASSERT_LESS_THAN_INT(0, ledc_alloc(
+        static_cast<int8_t>(usage_start.channels_total), LEDC_NO_PIN,
+        PWM_DIM_FREQ_HZ, PWM_DIM_RESOLUTION, false));
+    ledc_usage_t usage_end = ledc_get_usage();
+
+    TEST_ASSERT_EQUAL_UINT(usage_start.channels_used,
+        usage_end.channels_used);
+    TEST_ASSERT_EQUAL_UINT(usage_start.timers_used, usage_end.timers_used);
+}
+
+/**
+ * @details Once all timers are in use, outputs that need their own timer
+ * are rejected, and all of it is released at the end.
+ */
+static void test_timers_exhausted_and_released()
+{
+    ledc_usage_t usage_start = ledc_get_usage();
+    int8_t own[PWM_MAX_TIMERS];
+    uint8_t num_own = 0U;
+    int8_t chan = 0;
+
+    while ( (num_own < usage_start.timers_total) && (chan >= 0) )
+    {
+        chan = ledc_alloc(LEDC_ANY_CHANNEL, LEDC_NO_PIN, 1000U, 10U, true);
+        if (chan >= 0)
+        {   own[num_own++] = chan;   }
+    }
+    ledc_usage_t usage_full = ledc_get_usage();
+    int8_t rejected = ledc_alloc(LEDC_ANY_CHANNEL, LEDC_NO_PIN, 1000U, 10U,
+        true);
+    for (uint8_t i = 0U; i < num_own; i++)
+    {   ledc_free(own[i]);   }
+    ledc_usage_t usage_end = ledc_get_usage();
+
+    TEST_ASSERT_EQUAL_UINT(usage_full.timers_total, usage_full.timers_used);
+    TEST_ASSERT_EQUAL_UINT(usage_full.timers_total - usage_start.timers_used,
+        num_own);
+    TEST_ASSERT_LESS_THAN_INT(0, rejected);
+    TEST_ASSERT_EQUAL_UINT(usage_start.channels_used,
+        usage_end.channels_used);
+    TEST_ASSERT_EQUAL_UINT(usage_start.timers_used, usage_end.timers_used);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    native_app_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_frequency_sweep_no_timer_config);
+    RUN_TEST(test_shared_timer);
+    RUN_TEST(test_channel_in_use_rejected);
+    RUN_TEST(test_invalid_channel_rejected);
+    RUN_TEST(test_timers_exhausted_and_released);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,203 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the shared FT6236 touch panel driver with each
+ * I2C transport policy.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Project Headers
+#include "config/config.h"
+#include "hal/i2c_espidf.h"
+#include "hal/i2c_mock.h"
+#include "native/native.h"
+#include "native/native_app.h"
+#include "touch_panel/driver_ft6236.h"
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// Touch Panel on the mocked I2C device
+static FT6236<MockI2C> MockPanel;
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{
+    MockI2C::reset(FT6236<MockI2C>::I2C_ADDRESS);
+}
+
+void tearDown()
+{
+    MockI2C::fail = false;
+    native_touch_release();
+}
+
+/*****************************************************************************/
+
+/* Test Functions */
+
+/**
+ * @details Sets the mocked device registers of one touch point.
+ */
+static void mock_touch_point(const uint8_t event, const uint16_t x,
+    const uint16_t y)
+{
+    MockI2C::regs[0x02U] = 0x01U;
+    MockI2C::regs[0x03U] = (uint8_t)((event << 6) | ((x >> 8) & 0x0FU));
+    MockI2C::regs[0x04U] = (uint8_t)(x & 0xFFU);
+    MockI2C::regs[0x05U] = (uint8_t)((y >> 8) & 0x0FU);
+    MockI2C::regs[0x06U] = (uint8_t)(y & 0xFFU);
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details No touch points, contact, lift up and failed read samples.
+ */
+static void test_sample_decode()
+{
+    int pos[2];
+
+    MockPanel.get_position(pos);
+    TEST_ASSERT_EQUAL_INT(-1, pos[0]);
+    TEST_ASSERT_EQUAL_INT(-1, pos[1]);
+
+    mock_touch_point(0x02U, 0x123U, 0x140U);
+    MockPanel.get_position(pos);
+    TEST_ASSERT_EQUAL_INT(0x123, pos[0]);
+    TEST_ASSERT_EQUAL_INT(0x140, pos[1]);
+
+    mock_touch_point(0x01U, 0x123U, 0x140U);
+    MockPanel.get_position(pos);
+    TEST_ASSERT_EQUAL_INT(-1, pos[0]);
+    TEST_ASSERT_EQUAL_INT(-1, pos[1]);
+
+    mock_touch_point(0x02U, 0x123U, 0x140U);
+    MockI2C::fail = true;
+    MockPanel.get_position(pos);
+    TEST_ASSERT_EQUAL_INT(-1, pos[0]);
+    TEST_ASSERT_EQUAL_INT(-1, pos[1]);
+    TEST_ASSERT_EQUAL_UINT32(4U, MockI2C::reads);
+}
+
+/**
+ * @details Interrupt trigger mode and identifier commands.
+ */
+static void test_commands()
+{
+    uint8_t id[TOUCH_PANEL_ID_LENGTH];
+
+    MockI2C::regs[0xA1U] = 0x10U;
+    TEST_ASSERT_TRUE(MockPanel.set_int_trigger_mode());
+    TEST_ASSERT_EQUAL_UINT8(0x01U, MockI2C::regs[0xA4U]);
+    TEST_ASSERT_TRUE(MockPanel.read_id(id));
+    TEST_ASSERT_EQUAL_UINT8(0x10U, id[0]);
+    TEST_ASSERT_EQUAL_UINT8(0x01U, id[3]);
+    TEST_ASSERT_EQUAL_UINT32(1U, MockI2C::reads);
+    TEST_ASSERT_EQUAL_UINT32(1U, MockI2C::writes);
+}
+
+/**
+ * @details Reading the simulated panel straight through the ESP-IDF I2C
+ * driver must get the same position as through the I2C Bus Scheduler,
+ * without heap allocations.
+ */
+static void test_espidf_transport()
+{
+    FT6236<EspIdfI2C<I2C_PORT_TOUCH>> DirectPanel;
+    int pos_ref[2];
+    int pos[2];
+
+    native_touch_press(NATIVE_BUTTON_X, NATIVE_BUTTON_Y);
+    TouchPanel.get_position(pos_ref);
+    native_heap_stats_t heap_start = native_heap_stats();
+    DirectPanel.get_position(pos);
+    native_heap_stats_t heap_end = native_heap_stats();
+
+    TEST_ASSERT_GREATER_OR_EQUAL_INT(0, pos_ref[0]);
+    TEST_ASSERT_EQUAL_INT(pos_ref[0], pos[0]);
+    TEST_ASSERT_EQUAL_INT(pos_ref[1], pos[1]);
+    TEST_ASSERT_EQUAL_UINT32(0U, heap_end.allocs - heap_start.allocs);
+}
+
+/**
+ * @details The I2C Bus Scheduler transport must fail without a scheduler
+ * attached (not touching the bus), and read through the attached one.
+ */
+static void test_scheduler_transport_attach()
+{
+    uint8_t id[TOUCH_PANEL_ID_LENGTH];
+
+    TouchI2C::attach(nullptr);
+    uint32_t transactions_start = native_i2c_stats().transactions;
+    TEST_ASSERT_FALSE(TouchPanel.read_id(id));
+    TEST_ASSERT_EQUAL_UINT32(transactions_start,
+        native_i2c_stats().transactions);
+
+    TouchI2C::attach(&I2CBus);
+    TEST_ASSERT_TRUE(TouchPanel.read_id(id));
+    TEST_ASSERT_GREATER_THAN_UINT32(transactions_start,
+        native_i2c_stats().transactions);
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    native_app_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_sample_decode);
+    RUN_TEST(test_commands);
+    RUN_TEST(test_espidf_transport);
+    RUN_TEST(test_scheduler_transport_attach);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,203 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native tests of the Touch Panel interrupt path (Touch Task woken by the simulated INT line), built by the native_touch_int environment.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Project Headers
+#include "config/config.h"
+#include "native/native.h"
+#include "native/native_app.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Number of Touch Task steps run by each test
+static constexpr uint8_t TASK_STEPS = 5U;
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{
+    // Idle INT line (pulled up), run as the Touch Task, empty queue
+    native_gpio_input(IO_TOUCH_INT, 1U);
+    native_task_switch(touch_task_handle);
+    xQueueReset(touch_queue);
+}
+
+void tearDown()
+{
+    native_task_switch(nullptr);
+    native_touch_release();
+}
+
+/*****************************************************************************/
+
+/* Test Functions */
+
+/**
+ * @details Pulses the INT line as the FT6236 does on each new touch report
+ * (falling edge).
+ */
+static void touch_int_pulse()
+{
+    native_gpio_input(IO_TOUCH_INT, 0U);
+    native_gpio_input(IO_TOUCH_INT, 1U);
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details Touch Task was created and the INT interrupt handler attached.
+ */
+static void test_int_init()
+{
+    TEST_ASSERT_NOT_NULL(touch_task_handle);
+
+    uint32_t notifications = native_task_notifications(touch_task_handle);
+    touch_int_pulse();
+    TEST_ASSERT_EQUAL_UINT32(notifications + 1U,
+        native_task_notifications(touch_task_handle));
+    ulTaskNotifyTake(pdTRUE, 0U);
+}
+
+/**
+ * @details While not pressed and without INT edges the Touch Task keeps
+ * waiting: no I2C reads and no queued samples.
+ */
+static void test_no_reads_while_idle()
+{
+    native_i2c_stats_reset();
+
+    for (uint8_t i = 0U; i < TASK_STEPS; i++)
+    {   TEST_ASSERT_FALSE(touch_task_wait_read(false));   }
+
+    TEST_ASSERT_EQUAL_UINT32(0U, native_i2c_stats().transactions);
+    TEST_ASSERT_EQUAL_UINT32(0U, uxQueueMessagesWaiting(touch_queue));
+}
+
+/**
+ * @details Each INT edge (a new position or the lift up) gets exactly one
+ * panel read and one queued sample, and nothing else until the next edge
+ * (the pressed re-read on timeout is not an edge, it finds no change).
+ */
+static void test_one_read_per_edge()
+{
+    bool pressed = false;
+
+    for (uint8_t i = 0U; i < TASK_STEPS; i++)
+    {
+        native_touch_press(NATIVE_SLIDER_X_START + (i * 20U),
+            NATIVE_SLIDER_Y);
+        native_i2c_stats_reset();
+        UBaseType_t queued = uxQueueMessagesWaiting(touch_queue);
+        touch_int_pulse();
+        pressed = touch_task_wait_read(pressed);
+        TEST_ASSERT_TRUE(pressed);
+        TEST_ASSERT_EQUAL_UINT32(1U, native_i2c_stats().transactions);
+        TEST_ASSERT_EQUAL_UINT32(queued + 1U,
+            uxQueueMessagesWaiting(touch_queue));
+    }
+
+    native_touch_release();
+    native_i2c_stats_reset();
+    UBaseType_t queued = uxQueueMessagesWaiting(touch_queue);
+    touch_int_pulse();
+    pressed = touch_task_wait_read(pressed);
+    TEST_ASSERT_FALSE(pressed);
+    TEST_ASSERT_EQUAL_UINT32(1U, native_i2c_stats().transactions);
+    TEST_ASSERT_EQUAL_UINT32(queued + 1U,
+        uxQueueMessagesWaiting(touch_queue));
+
+    native_i2c_stats_reset();
+    for (uint8_t i = 0U; i < TASK_STEPS; i++)
+    {   pressed = touch_task_wait_read(pressed);   }
+    TEST_ASSERT_EQUAL_UINT32(0U, native_i2c_stats().transactions);
+    TEST_ASSERT_EQUAL_UINT32(queued + 1U,
+        uxQueueMessagesWaiting(touch_queue));
+}
+
+/**
+ * @details While pressed, a missed lift up is caught by the re-read on
+ * timeout (one read per timeout, without any INT edge).
+ */
+static void test_pressed_timeout_reread()
+{
+    native_touch_press(NATIVE_BUTTON_X, NATIVE_BUTTON_Y);
+    touch_int_pulse();
+    TEST_ASSERT_TRUE(touch_task_wait_read(false));
+
+    native_touch_release();
+    native_i2c_stats_reset();
+    int64_t t_start_us = esp_timer_get_time();
+    TEST_ASSERT_FALSE(touch_task_wait_read(true));
+    int64_t t_wait_ms = (esp_timer_get_time() - t_start_us) / 1000LL;
+
+    TEST_ASSERT_EQUAL_UINT32(1U, native_i2c_stats().transactions);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT(
+        (int)(ns_const::TOUCH_PRESSED_TIMEOUT_MS), (int)(t_wait_ms));
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    // Touch Task is created (not run), the tests run its steps
+    native_task_enable("task_touch");
+    native_app_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_int_init);
+    RUN_TEST(test_no_reads_while_idle);
+    RUN_TEST(test_one_read_per_edge);
+    RUN_TEST(test_pressed_timeout_reread);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,150 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the UI values binder (bound labels updated once
+ * per frame, only on value change).
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// Graphic Libraies
+#include <lvgl.h>
+
+// Project Headers
+#include "native/native_app.h"
+#include "ui/ui_binder.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Frames of the same value reported over and over
+static constexpr uint32_t BINDER_REPEATED_FRAMES = 10U;
+
+/*****************************************************************************/
+
+/* In-Scope Attributes */
+
+// Binder under test, and its bound label
+static UIBinder* binder = nullptr;
+static lv_obj_t* label = nullptr;
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{
+    binder = new UIBinder();
+    label = lv_label_create(lv_scr_act());
+    binder->bind_label(0U, label, "%ld, %ld");
+    binder->set(0U, 0, 0);
+    binder->apply();
+}
+
+void tearDown()
+{
+    lv_obj_del(label);
+    label = nullptr;
+    delete binder;
+    binder = nullptr;
+}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details The same value set frame after frame must not update the label.
+ */
+static void test_repeated_value_no_update()
+{
+    uint32_t updates = 0U;
+
+    for (uint32_t frame = 0U; frame < BINDER_REPEATED_FRAMES; frame++)
+    {
+        binder->set(0U, 0, 0);
+        updates = updates + binder->apply();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0U, updates);
+}
+
+/**
+ * @details A value changed and restored within the frame is the rendered
+ * one, the label must not be updated.
+ */
+static void test_restored_value_no_update()
+{
+    binder->set(0U, 120, 40);
+    binder->set(0U, 0, 0);
+
+    TEST_ASSERT_EQUAL_UINT32(0U, binder->apply());
+}
+
+/**
+ * @details Several changes within the frame must update the label once,
+ * with the last value.
+ */
+static void test_changed_value_one_update()
+{
+    binder->set(0U, 120, 40);
+    binder->set(0U, 121, 41);
+
+    TEST_ASSERT_EQUAL_UINT32(1U, binder->apply());
+    TEST_ASSERT_EQUAL_STRING("121, 41", lv_label_get_text(label));
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    native_app_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_repeated_value_no_update);
+    RUN_TEST(test_restored_value_no_update);
+    RUN_TEST(test_changed_value_one_update);
+    return UNITY_END();
+}
+
+/*****************************************************************************/
@@ -0,0 +1,196 @@
+/**
+ * @file    test_main.cpp
+ * @author  Jose Miguel Rios Rubio <jrios.github@gmail.com>
+ * @date    2026-10-16
+ * @version 1.0.0
+ *
+ * @section DESCRIPTION
+ *
+ * Native (host) tests of the UI Task loop: idle wake-ups and touch
+ * samples response.
+ *
+ * @section LICENSE
+ *
+ * MIT License
+ *
+ * Copyright (c) 2026 Jose Miguel Rios Rubio
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*****************************************************************************/
+
+/* Libraries */
+
+// Unit Testing Framework
+#include <unity.h>
+
+// Standard C++ Libraries
+#include <cstdint>
+
+// ESP-IDF Framework
+#include "esp_timer.h"
+
+// FreeRTOS Libraries
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+// Graphic Libraies
+#include <lvgl.h>
+
+// Project Headers
+#include "native/native.h"
+#include "native/native_app.h"
+
+/*****************************************************************************/
+
+/* In-Scope Constants */
+
+// Idle wake-ups measure time, previous fixed 5ms period UI Task loop, and
+// max allowed wake-ups
+static constexpr uint32_t UI_IDLE_TIME_MS = 1000U;
+static constexpr uint32_t UI_IDLE_FIXED_PERIOD_MS = 5U;
+static constexpr uint32_t UI_IDLE_MAX_WAKEUPS_PER_S =
+    (1000U / UI_IDLE_FIXED_PERIOD_MS) / 4U;
+
+/*****************************************************************************/
+
+/* Test Fixtures */
+
+void setUp()
+{
+    // Settle any pending UI work, so the LVGL input read is not due
+    native_time_advance_ms(NATIVE_FRAME_PERIOD_MS);
+    manage_ui();
+}
+
+void tearDown()
+{
+    native_touch_release();
+}
+
+/*****************************************************************************/
+
+/* Test Functions */
+
+// Task stand-in (the native build never runs the tasks)
+static void test_task(void* arg)
+{}
+
+/*****************************************************************************/
+
+/* Tests */
+
+/**
+ * @details Runs the UI Task loop on an idle screen as the target does,
+ * sleeping the time returned by manage_ui() (rounded up to RTOS ticks), and
+ * counts its wake-ups against the previous fixed period loop.
+ */
+static void test_idle_wakeups()
+{
+    uint32_t wakeups = 0U;
+    int64_t t_end = esp_timer_get_time() + (UI_IDLE_TIME_MS * 1000LL);
+
+    while (esp_timer_get_time() < t_end)
+    {
+        TickType_t ticks = ms_to_ticks_ceil(manage_ui());
+        if ( (ticks == 0U) || (ticks == portMAX_DELAY) )
+        {   ticks = 1U;   }
+        native_time_advance_ms(ticks * portTICK_PERIOD_MS);
+        wakeups = wakeups + 1U;
+    }
+
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(UI_IDLE_MAX_WAKEUPS_PER_S,
+        (wakeups * 1000U) / UI_IDLE_TIME_MS);
+}
+
+/**
+ * @details A new touch sample must be handled by LVGL on the UI Task
+ * wake-up that follows it, not on the next LVGL input device read period.
+ */
+static void test_touch_response()
+{
+    native_time_advance_ms(1U);
+    native_touch_press(NATIVE_SLIDER_X_START, NATIVE_SLIDER_Y);
+    touch_read_sample();
+    manage_ui();
+    TEST_ASSERT_EQUAL_UINT32(0U, uxQueueMessagesWaiting(touch_queue));
+
+    native_time_advance_ms(1U);
+    native_touch_release();
+    touch_read_sample();
+    manage_ui();
+    TEST_ASSERT_EQUAL_UINT32(0U, uxQueueMessagesWaiting(touch_queue));
+}
+
+/**
+ * @details While a DMA flush transfer is in progress, the UI Task must
+ * sleep (at least a tick) instead of polling the transfer end in a loop.
+ */
+static void test_flush_pending_sleeps()
+{
+    uint32_t dma_calls_start = Screen.stats().dma_write_calls;
+
+    lv_obj_invalidate(lv_scr_act());
+    native_time_advance_ms(NATIVE_FRAME_PERIOD_MS);
+    uint32_t sleep_ms = manage_ui();
+
+    TEST_ASSERT_GREATER_THAN_UINT32(dma_calls_start,
+        Screen.stats().dma_write_calls);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1U, ms_to_ticks_ceil(sleep_ms));
+    display_flush_wait_all();
+}
+
+/**
+ * @details The LCD_CAM transfer done interrupt must wake the UI Task up.
+ */
+static void test_flush_done_wakes_ui()
+{
+    TaskHandle_t task = nullptr;
+
+    native_task_enable("task_ui");
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreatePinnedToCore(test_task, "task_ui",
+        4096U, nullptr, 1U, &task, 1));
+    ui_task_handle = task;
+    uint32_t notifications = native_task_notifications(task);
+
+    native_lcd_trans_done();
+    TEST_ASSERT_EQUAL_UINT32(notifications + 1U,
+        native_task_notifications(task));
+    ui_task_handle = nullptr;
+}
+
+/*****************************************************************************/
+
+/* Main Function */
+
+int main()
+{
+    native_app_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_idle_wakeups);
+    RUN_TEST(test_touch_response);
+    RUN_TEST(test_flush_pending_sleeps);
+    RUN_TEST(test_flush_done_wakes_ui);
+    return UNITY_END();
+}
+
+/*****************************************************************************/